@@ -56,6 +56,13 @@
 #  endif
 #endif
 
+/* The hash index generated along with the system symbol table */
+
+#if defined(CONFIG_EXECFUNCS_SYSTEM_SYMTAB) && defined(CONFIG_SYMTAB_HASHED)
+#  define SYMTAB_HASH(a)  SYMTAB_HASH_(a)
+#  define SYMTAB_HASH_(a) a##_hash
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -65,6 +72,10 @@ extern const struct symtab_s CONFIG_EXECFUNCS_SYMTAB_ARRAY[];
 extern int CONFIG_EXECFUNCS_NSYMBOLS_VAR;
 #endif
 
+#ifdef SYMTAB_HASH
+extern const struct symtab_hash_s SYMTAB_HASH(CONFIG_EXECFUNCS_SYMTAB_ARRAY);
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -114,6 +125,9 @@ void exec_getsymtab(FAR const struct symtab_s **symtab, FAR int *nsymbols)
     {
       g_exec_symtab = CONFIG_EXECFUNCS_SYMTAB_ARRAY;
       g_exec_nsymbols = CONFIG_EXECFUNCS_NSYMBOLS_VAR;
+#ifdef SYMTAB_HASH
+      symtab_register_hash(&SYMTAB_HASH(CONFIG_EXECFUNCS_SYMTAB_ARRAY));
+#endif
     }
 #endif
 
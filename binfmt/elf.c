@@ -35,6 +35,7 @@
 
 #include <nuttx/arch.h>
 #include <nuttx/binfmt/binfmt.h>
+#include <nuttx/clock.h>
 #include <nuttx/kmalloc.h>
 
 #ifdef CONFIG_ELF
@@ -55,6 +56,15 @@
 #  define CONFIG_ELF_STACKSIZE 2048
 #endif
 
+/* Load time instrumentation: timestamps taken at the end of each phase */
+
+#ifdef CONFIG_ELF_LOADTIME
+#  define ELF_TIMESTAMP(t) ((t) = perf_gettime())
+#else
+#  define ELF_TIMESTAMP(t)
+#  define elf_dumploadtime(f, t)
+#endif
+
 /****************************************************************************
  * Private Function Prototypes
  ****************************************************************************/
@@ -81,6 +91,34 @@ static struct binfmt_s g_elfbinfmt =
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: elf_dumploadtime
+ *
+ * Description:
+ *   Report the time spent in each phase of elf_loadbinary().  ts[0] is
+ *   taken on entry, ts[1] after the headers are read, ts[2] after the
+ *   sections are loaded and ts[3] after the symbols are bound.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_ELF_LOADTIME
+static unsigned long elf_elapsed(clock_t start, clock_t end)
+{
+  struct timespec ts;
+
+  perf_convert(end - start, &ts);
+  return ts.tv_sec * 1000000ul + ts.tv_nsec / 1000;
+}
+
+static void elf_dumploadtime(FAR const char *filename,
+                             FAR const clock_t *ts)
+{
+  binfo("%s: initialize %lu us, load %lu us, bind %lu us\n", filename,
+        elf_elapsed(ts[0], ts[1]), elf_elapsed(ts[1], ts[2]),
+        elf_elapsed(ts[2], ts[3]));
+}
+#endif
+
 /****************************************************************************
  * Name: elf_loadbinary
  *
@@ -96,9 +134,13 @@ static int elf_loadbinary(FAR struct binary_s *binp,
                           int nexports)
 {
   struct mod_loadinfo_s loadinfo;
+#ifdef CONFIG_ELF_LOADTIME
+  clock_t ts[4];
+#endif
   int ret;
 
   binfo("Loading file: %s\n", filename);
+  ELF_TIMESTAMP(ts[0]);
 
   /* Initialize the ELF library to load the program binary. */
 
@@ -110,6 +152,8 @@ static int elf_loadbinary(FAR struct binary_s *binp,
       return ret;
     }
 
+  ELF_TIMESTAMP(ts[1]);
+
   /* Load the program binary */
 
   ret = libelf_load_with_addrenv(&loadinfo);
@@ -120,6 +164,8 @@ static int elf_loadbinary(FAR struct binary_s *binp,
       goto errout_with_init;
     }
 
+  ELF_TIMESTAMP(ts[2]);
+
   /* Bind the program to the exported symbol table */
 
   if (loadinfo.ehdr.e_type == ET_REL || loadinfo.gotindex >= 0)
@@ -155,6 +201,8 @@ static int elf_loadbinary(FAR struct binary_s *binp,
       goto errout_with_load;
     }
 
+  ELF_TIMESTAMP(ts[3]);
+
   /* Return the load information */
 
   binp->stacksize = CONFIG_ELF_STACKSIZE;
@@ -227,6 +275,7 @@ static int elf_loadbinary(FAR struct binary_s *binp,
     }
 #endif
 
+  elf_dumploadtime(filename, ts);
   libelf_uninitialize(&loadinfo);
   return OK;
 
@@ -42,6 +42,11 @@
 
 #define MAX_OPENCNT       (255)                  /* Limit of uint8_t */
 
+/* The address of a sector held in the buffer */
+
+#define BCH_SECTOR_BUFFER(bch, s) \
+  (&(bch)->buffer[((s) - (bch)->sector) * (bch)->sectsize])
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -51,13 +56,16 @@ struct bchlib_s
   FAR struct inode *inode; /* I-node of the block driver */
   uint32_t sectsize;       /* The size of one sector on the device */
   size_t nsectors;         /* Number of sectors supported by the device */
-  size_t sector;           /* The current sector in the buffer */
+  size_t sector;           /* The first sector in the buffer */
   mutex_t lock;            /* For atomic accesses to this structure */
+  uint16_t ncached;        /* Number of sectors in the buffer */
+  uint16_t dirtystart;     /* Index of the first modified sector */
+  uint16_t dirtyend;       /* Index after the last modified sector */
   uint8_t refs;            /* Number of references */
-  bool dirty;              /* true: Data has been written to the buffer */
   bool readonly;           /* true: Only read operations are supported */
   bool unlinked;           /* true: The driver has been unlinked */
-  FAR uint8_t *buffer;     /* One sector buffer */
+  FAR uint8_t *buffer;     /* Buffer of up to CONFIG_BCH_CACHE_NSECTORS
+                            * consecutive sectors */
 
 #if defined(CONFIG_BCH_ENCRYPTION)
   uint8_t key[CONFIG_BCH_ENCRYPTION_KEY_SIZE];  /* Encryption key */
@@ -85,6 +93,8 @@ EXTERN const struct file_operations g_bch_fops;
 
 EXTERN int  bchlib_flushsector(FAR struct bchlib_s *bch, bool discard);
 EXTERN int  bchlib_readsector(FAR struct bchlib_s *bch, size_t sector);
+EXTERN int  bchlib_newsector(FAR struct bchlib_s *bch, size_t sector);
+EXTERN void bchlib_dirtysector(FAR struct bchlib_s *bch, size_t sector);
 
 #undef EXTERN
 #if defined(__cplusplus)
@@ -437,9 +437,10 @@ static int bch_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 
       case BIOC_DISCARD:
         {
-          /* Invalidate the sector so next read is from the device- */
+          /* Invalidate the buffer so next read is from the device- */
 
-          bch->sector = (size_t)-1;
+          bch->sector  = (size_t)-1;
+          bch->ncached = 0;
           goto ioctl_default;
         }
 
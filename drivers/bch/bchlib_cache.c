@@ -28,6 +28,7 @@
 #include <nuttx/kmalloc.h>
 
 #include <sys/types.h>
+#include <sys/param.h>
 #include <stdbool.h>
 #include <errno.h>
 #include <assert.h>
@@ -62,34 +63,68 @@ static void bch_xor(uint32_t *R, uint32_t *A, uint32_t *B)
  ****************************************************************************/
 
 #if defined(CONFIG_BCH_ENCRYPTION)
-static int bch_cypher(FAR struct bchlib_s *bch, int encrypt)
+static int bch_cypher(FAR struct bchlib_s *bch, size_t sector,
+                      size_t nsectors, int encrypt)
 {
   int blocks = bch->sectsize / 16;
-  FAR uint32_t *buffer = (FAR uint32_t *)bch->buffer;
+  FAR uint32_t *buffer = (FAR uint32_t *)BCH_SECTOR_BUFFER(bch, sector);
   int i;
 
-  for (i = 0; i < blocks; i++, buffer += 16 / sizeof(uint32_t) )
+  for (; nsectors > 0; nsectors--, sector++)
     {
-      uint32_t T[4];
-      uint32_t X[4] =
-      {
-        bch->sector, 0, 0, i
-      };
+      for (i = 0; i < blocks; i++, buffer += 16 / sizeof(uint32_t))
+        {
+          uint32_t T[4];
+          uint32_t X[4] =
+          {
+            sector, 0, 0, i
+          };
+
+          aes_cypher(X, X, 16, NULL, bch->key,
+                     CONFIG_BCH_ENCRYPTION_KEY_SIZE, AES_MODE_ECB,
+                     CYPHER_ENCRYPT);
+
+          /* Xor-Encrypt-Xor */
+
+          bch_xor(T, X, buffer);
+          aes_cypher(T, T, 16, NULL, bch->key,
+                     CONFIG_BCH_ENCRYPTION_KEY_SIZE, AES_MODE_ECB, encrypt);
+          bch_xor(buffer, X, T);
+        }
+    }
 
-      aes_cypher(X, X, 16, NULL, bch->key, CONFIG_BCH_ENCRYPTION_KEY_SIZE,
-                 AES_MODE_ECB, CYPHER_ENCRYPT);
+  return OK;
+}
+#endif
 
-      /* Xor-Encrypt-Xor */
+/****************************************************************************
+ * Name: bchlib_allocbuffer
+ *
+ * Description:
+ *   Allocate the sector buffer on first use
+ *
+ ****************************************************************************/
 
-      bch_xor(T, X, buffer);
-      aes_cypher(T, T, 16, NULL, bch->key, CONFIG_BCH_ENCRYPTION_KEY_SIZE,
-                 AES_MODE_ECB, encrypt);
-      bch_xor(buffer, X, T);
+static int bchlib_allocbuffer(FAR struct bchlib_s *bch)
+{
+  if (bch->buffer == NULL)
+    {
+      size_t size = CONFIG_BCH_CACHE_NSECTORS * bch->sectsize;
+
+#if CONFIG_BCH_BUFFER_ALIGNMENT != 0
+      bch->buffer = kmm_memalign(CONFIG_BCH_BUFFER_ALIGNMENT, size);
+#else
+      bch->buffer = kmm_malloc(size);
+#endif
+      if (bch->buffer == NULL)
+        {
+          ferr("Failed to allocate sector buffer\n");
+          return -ENOMEM;
+        }
     }
 
   return OK;
 }
-#endif
 
 /****************************************************************************
  * Public Functions
@@ -99,7 +134,8 @@ static int bch_cypher(FAR struct bchlib_s *bch, int encrypt)
  * Name: bchlib_flushsector
  *
  * Description:
- *   Flush the current contents of the sector buffer (if dirty)
+ *   Flush the modified sectors of the buffer (if any) with a single write
+ *   to the block driver.  The buffer is invalidated if discard is true.
  *
  * Assumptions:
  *   Caller must assume mutual exclusion
@@ -109,25 +145,30 @@ static int bch_cypher(FAR struct bchlib_s *bch, int encrypt)
 int bchlib_flushsector(FAR struct bchlib_s *bch, bool discard)
 {
   FAR struct inode *inode;
+  size_t sector;
+  size_t nsectors;
   ssize_t ret = OK;
 
-  /* Check if the sector has been modified and is out of synch with the
+  /* Check if sectors have been modified and are out of synch with the
    * media.
    */
 
-  if (bch->dirty && bch->buffer != NULL)
+  if (bch->ncached > 0 && bch->dirtyend > bch->dirtystart)
     {
-      inode = bch->inode;
+      inode    = bch->inode;
+      sector   = bch->sector + bch->dirtystart;
+      nsectors = bch->dirtyend - bch->dirtystart;
 
 #if defined(CONFIG_BCH_ENCRYPTION)
       /* Encrypt data as necessary */
 
-      bch_cypher(bch, CYPHER_ENCRYPT);
+      bch_cypher(bch, sector, nsectors, CYPHER_ENCRYPT);
 #endif
 
-      /* Write the sector to the media */
+      /* Write the sectors to the media */
 
-      ret = inode->u.i_bops->write(inode, bch->buffer, bch->sector, 1);
+      ret = inode->u.i_bops->write(inode, BCH_SECTOR_BUFFER(bch, sector),
+                                   sector, nsectors);
       if (ret < 0)
         {
           ferr("Write failed: %zd\n", ret);
@@ -139,17 +180,21 @@ int bchlib_flushsector(FAR struct bchlib_s *bch, bool discard)
        * TODO: Add configuration switch for extra sector buffer
        */
 
-      bch_cypher(bch, CYPHER_DECRYPT);
+      bch_cypher(bch, sector, nsectors, CYPHER_DECRYPT);
 #endif
 
-      /* The sector is now in sync with the media */
+      /* The sectors are now in sync with the media */
 
-      bch->dirty = false;
+      ret = OK;
     }
 
+  bch->dirtystart = 0;
+  bch->dirtyend   = 0;
+
   if (discard)
     {
-      bch->sector = (size_t)-1;
+      bch->sector  = (size_t)-1;
+      bch->ncached = 0;
     }
 
   return (int)ret;
@@ -159,7 +204,9 @@ int bchlib_flushsector(FAR struct bchlib_s *bch, bool discard)
  * Name: bchlib_readsector
  *
  * Description:
- *   Read the current sector contents into buffer
+ *   Make the buffer hold the contents of the sector.  On a miss that
+ *   continues a sequential access, the following sectors are read ahead
+ *   into the buffer with the same request to the block driver.
  *
  * Assumptions:
  *   Caller must assume mutual exclusion
@@ -169,45 +216,143 @@ int bchlib_flushsector(FAR struct bchlib_s *bch, bool discard)
 int bchlib_readsector(FAR struct bchlib_s *bch, size_t sector)
 {
   FAR struct inode *inode;
-  ssize_t ret = OK;
+  size_t nsectors = 1;
+  ssize_t ret;
 
-  if (bch->buffer == NULL)
+  ret = bchlib_allocbuffer(bch);
+  if (ret < 0)
     {
-#if CONFIG_BCH_BUFFER_ALIGNMENT != 0
-      bch->buffer = kmm_memalign(CONFIG_BCH_BUFFER_ALIGNMENT, bch->sectsize);
-#else
-      bch->buffer = kmm_malloc(bch->sectsize);
+      return (int)ret;
+    }
+
+  if (bch->ncached > 0 && sector >= bch->sector &&
+      sector < bch->sector + bch->ncached)
+    {
+      return OK;
+    }
+
+  /* Read ahead if the sector follows the buffer */
+
+  if (bch->ncached > 0 && sector == bch->sector + bch->ncached)
+    {
+      nsectors = MIN(CONFIG_BCH_CACHE_NSECTORS, bch->nsectors - sector);
+    }
+
+  inode = bch->inode;
+
+  ret = bchlib_flushsector(bch, true);
+  if (ret < 0)
+    {
+      ferr("Flush failed: %zd\n", ret);
+      return (int)ret;
+    }
+
+  ret = inode->u.i_bops->read(inode, bch->buffer, sector, nsectors);
+  if (ret < 0)
+    {
+      ferr("Read failed: %zd\n", ret);
+      return (int)ret;
+    }
+
+  /* Keep only what the driver returned */
+
+  if (ret > 0 && ret < nsectors)
+    {
+      nsectors = ret;
+    }
+
+  bch->sector  = sector;
+  bch->ncached = nsectors;
+#if defined(CONFIG_BCH_ENCRYPTION)
+  bch_cypher(bch, sector, nsectors, CYPHER_DECRYPT);
 #endif
-      if (bch->buffer == NULL)
-        {
-          ferr("Failed to allocate sector buffer\n");
-          return -ENOMEM;
-        }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: bchlib_newsector
+ *
+ * Description:
+ *   Make room in the buffer for a sector that is about to be completely
+ *   overwritten, without reading it from the media, and mark it modified.
+ *   Consecutive sectors are gathered in the buffer so that they are
+ *   written back together.
+ *
+ * Assumptions:
+ *   Caller must assume mutual exclusion
+ *
+ ****************************************************************************/
+
+int bchlib_newsector(FAR struct bchlib_s *bch, size_t sector)
+{
+  int ret;
+
+  ret = bchlib_allocbuffer(bch);
+  if (ret < 0)
+    {
+      return ret;
     }
 
-  if (bch->sector != sector)
+  if (bch->ncached > 0 && sector >= bch->sector &&
+      sector < bch->sector + bch->ncached)
     {
-      inode = bch->inode;
+      /* Already in the buffer */
+    }
+  else if (bch->ncached > 0 && bch->ncached < CONFIG_BCH_CACHE_NSECTORS &&
+           sector == bch->sector + bch->ncached)
+    {
+      /* Grow the buffer by the sector */
 
-      ret = bchlib_flushsector(bch, true);
-      if (ret < 0)
-        {
-          ferr("Flush failed: %zd\n", ret);
-          return (int)ret;
-        }
+      bch->ncached++;
+    }
+  else
+    {
+      /* Start over with the sector */
 
-      ret = inode->u.i_bops->read(inode, bch->buffer, sector, 1);
+      ret = bchlib_flushsector(bch, true);
       if (ret < 0)
         {
-          ferr("Read failed: %zd\n", ret);
-          return (int)ret;
+          ferr("Flush failed: %d\n", ret);
+          return ret;
         }
 
-      bch->sector = sector;
-#if defined(CONFIG_BCH_ENCRYPTION)
-      bch_cypher(bch, CYPHER_DECRYPT);
-#endif
+      bch->sector  = sector;
+      bch->ncached = 1;
     }
 
-  return (int)ret;
+  bchlib_dirtysector(bch, sector);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: bchlib_dirtysector
+ *
+ * Description:
+ *   Mark a sector of the buffer as modified
+ *
+ * Assumptions:
+ *   Caller must assume mutual exclusion
+ *
+ ****************************************************************************/
+
+void bchlib_dirtysector(FAR struct bchlib_s *bch, size_t sector)
+{
+  uint16_t index = sector - bch->sector;
+
+  DEBUGASSERT(sector >= bch->sector && index < bch->ncached);
+
+  if (bch->dirtyend <= bch->dirtystart)
+    {
+      bch->dirtystart = index;
+      bch->dirtyend   = index + 1;
+    }
+  else if (index < bch->dirtystart)
+    {
+      bch->dirtystart = index;
+    }
+  else if (index >= bch->dirtyend)
+    {
+      bch->dirtyend = index + 1;
+    }
 }
@@ -27,6 +27,7 @@
 #include <nuttx/config.h>
 
 #include <sys/types.h>
+#include <sys/param.h>
 #include <stdint.h>
 #include <string.h>
 #include <errno.h>
@@ -75,6 +76,7 @@ ssize_t bchlib_read(FAR void *handle, FAR char *buffer, off_t offset,
   uint16_t sectoffset;
   size_t   nbytes;
   size_t   bytesread;
+  size_t   count;
   int      ret;
 
   /* Get rid of this special case right away */
@@ -120,7 +122,7 @@ ssize_t bchlib_read(FAR void *handle, FAR char *buffer, off_t offset,
           nbytes = len;
         }
 
-      memcpy(buffer, &bch->buffer[sectoffset], nbytes);
+      memcpy(buffer, BCH_SECTOR_BUFFER(bch, sector) + sectoffset, nbytes);
 
       /* Adjust pointers and counts */
 
@@ -136,9 +138,7 @@ ssize_t bchlib_read(FAR void *handle, FAR char *buffer, off_t offset,
       len       -= nbytes;
     }
 
-  /* Then read all of the full sectors following the partial sector directly
-   * into the user buffer.
-   */
+  /* Then read all of the full sectors following the partial sector */
 
   if (len >= bch->sectsize)
     {
@@ -148,17 +148,60 @@ ssize_t bchlib_read(FAR void *handle, FAR char *buffer, off_t offset,
           nsectors = bch->nsectors - sector;
         }
 
-      ret = bch->inode->u.i_bops->read(bch->inode, (FAR uint8_t *)buffer,
-                                       sector, nsectors);
-      if (ret < 0)
+      if (nsectors < CONFIG_BCH_CACHE_NSECTORS)
         {
-          ferr("ERROR: Read failed: %d\n", ret);
-          return ret;
+          /* A few sectors, take them from the sector buffer which reads
+           * ahead the sequential accesses.
+           */
+
+          for (count = nsectors; count > 0; count -= nbytes)
+            {
+              ret = bchlib_readsector(bch, sector);
+              if (ret < 0)
+                {
+                  return ret;
+                }
+
+              nbytes = MIN(count, bch->sector + bch->ncached - sector);
+              memcpy(buffer, BCH_SECTOR_BUFFER(bch, sector),
+                     nbytes * bch->sectsize);
+
+              sector += nbytes;
+              buffer += nbytes * bch->sectsize;
+            }
+        }
+      else
+        {
+          /* Many sectors, read them directly into the user buffer.  But
+           * first write back the modified sectors that they include.
+           */
+
+          if (bch->dirtyend > bch->dirtystart &&
+              sector < bch->sector + bch->dirtyend &&
+              sector + nsectors > bch->sector + bch->dirtystart)
+            {
+              ret = bchlib_flushsector(bch, false);
+              if (ret < 0)
+                {
+                  ferr("ERROR: Flush failed: %d\n", ret);
+                  return ret;
+                }
+            }
+
+          ret = bch->inode->u.i_bops->read(bch->inode, (FAR uint8_t *)buffer,
+                                           sector, nsectors);
+          if (ret < 0)
+            {
+              ferr("ERROR: Read failed: %d\n", ret);
+              return ret;
+            }
+
+          sector += nsectors;
+          buffer += nsectors * bch->sectsize;
         }
 
       /* Adjust pointers and counts */
 
-      sector    += nsectors;
       nbytes     = nsectors * bch->sectsize;
       bytesread += nbytes;
 
@@ -167,7 +210,6 @@ ssize_t bchlib_read(FAR void *handle, FAR char *buffer, off_t offset,
           return bytesread;
         }
 
-      buffer    += nbytes;
       len       -= nbytes;
     }
 
@@ -185,7 +227,7 @@ ssize_t bchlib_read(FAR void *handle, FAR char *buffer, off_t offset,
 
       /* Copy the head end of the sector to the user buffer */
 
-      memcpy(buffer, bch->buffer, len);
+      memcpy(buffer, BCH_SECTOR_BUFFER(bch, sector), len);
 
       /* Adjust counts */
 
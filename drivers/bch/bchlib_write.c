@@ -106,8 +106,8 @@ ssize_t bchlib_write(FAR void *handle, FAR const char *buffer, off_t offset,
           nbytes = len;
         }
 
-      memcpy(&bch->buffer[sectoffset], buffer, nbytes);
-      bch->dirty = true;
+      memcpy(BCH_SECTOR_BUFFER(bch, sector) + sectoffset, buffer, nbytes);
+      bchlib_dirtysector(bch, sector);
 
       /* Adjust pointers and counts */
 
@@ -132,35 +132,51 @@ ssize_t bchlib_write(FAR void *handle, FAR const char *buffer, off_t offset,
 
   while (len > 0)
     {
-      /* Read the sector into the sector buffer */
+      /* Full sectors are not read before being overwritten */
 
-      ret = bchlib_readsector(bch, sector);
-      if (ret < 0)
+      if (len >= bch->sectsize)
         {
-          return ret;
+          ret = bchlib_newsector(bch, sector);
+          nbytes = bch->sectsize;
+        }
+      else
+        {
+          ret = bchlib_readsector(bch, sector);
+          nbytes = len;
         }
 
-      /* Copy the data from the user buffer to the sector buffer */
-
-      nbytes = len > bch->sectsize ? bch->sectsize : len;
-      memcpy(bch->buffer, buffer, nbytes);
-      bch->dirty = true;
-
-      /* Write the sector back to the block device */
-
-      ret = bchlib_flushsector(bch, false);
       if (ret < 0)
         {
-          ferr("ERROR: Flush failed: %d\n", ret);
           return ret;
         }
 
+      /* Copy the data from the user buffer to the sector buffer */
+
+      memcpy(BCH_SECTOR_BUFFER(bch, sector), buffer, nbytes);
+      bchlib_dirtysector(bch, sector);
+
       /* Adjust pointers and counts */
 
       buffer       += nbytes;
       len          -= nbytes;
       byteswritten += nbytes;
       sector++;
+
+      /* This path is write-through:  Write the sectors back to the block
+       * device before returning.  The sectors written by this request are
+       * gathered in the sector buffer (up to CONFIG_BCH_CACHE_NSECTORS) and
+       * written together.
+       */
+
+      if (len == 0)
+        {
+          ret = bchlib_flushsector(bch, false);
+          if (ret < 0)
+            {
+              ferr("ERROR: Flush failed: %d\n", ret);
+              return ret;
+            }
+        }
     }
 #else
 
@@ -175,24 +191,47 @@ ssize_t bchlib_write(FAR void *handle, FAR const char *buffer, off_t offset,
           nsectors = bch->nsectors - sector;
         }
 
-      /* Flush the dirty sector to keep the sector sequence */
-
-      ret = bchlib_flushsector(bch, sector <= bch->sector &&
-                               bch->sector < (sector + nsectors));
-      if (ret < 0)
+      if (nsectors < CONFIG_BCH_CACHE_NSECTORS)
         {
-          ferr("ERROR: Flush failed: %d\n", ret);
-          return ret;
+          /* A few sectors, gather them in the sector buffer so that
+           * consecutive writes reach the block driver together.
+           */
+
+          for (nbytes = 0; nbytes < nsectors; nbytes++)
+            {
+              ret = bchlib_newsector(bch, sector + nbytes);
+              if (ret < 0)
+                {
+                  return ret;
+                }
+
+              memcpy(BCH_SECTOR_BUFFER(bch, sector + nbytes),
+                     buffer + nbytes * bch->sectsize, bch->sectsize);
+            }
         }
-
-      /* Write the contiguous sectors */
-
-      ret = bch->inode->u.i_bops->write(bch->inode, (FAR uint8_t *)buffer,
-                                        sector, nsectors);
-      if (ret < 0)
+      else
         {
-          ferr("ERROR: Write failed: %d\n", ret);
-          return ret;
+          /* Flush the dirty sectors to keep the sector sequence */
+
+          ret = bchlib_flushsector(bch, bch->ncached > 0 &&
+                                   sector < bch->sector + bch->ncached &&
+                                   bch->sector < sector + nsectors);
+          if (ret < 0)
+            {
+              ferr("ERROR: Flush failed: %d\n", ret);
+              return ret;
+            }
+
+          /* Write the contiguous sectors */
+
+          ret = bch->inode->u.i_bops->write(bch->inode,
+                                            (FAR uint8_t *)buffer,
+                                            sector, nsectors);
+          if (ret < 0)
+            {
+              ferr("ERROR: Write failed: %d\n", ret);
+              return ret;
+            }
         }
 
       /* Adjust pointers and counts */
@@ -224,8 +263,8 @@ ssize_t bchlib_write(FAR void *handle, FAR const char *buffer, off_t offset,
 
       /* Copy the head end of the sector from the user buffer */
 
-      memcpy(bch->buffer, buffer, len);
-      bch->dirty = true;
+      memcpy(BCH_SECTOR_BUFFER(bch, sector), buffer, len);
+      bchlib_dirtysector(bch, sector);
 
       /* Adjust counts */
 
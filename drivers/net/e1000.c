@@ -202,11 +202,15 @@ static void e1000_rxclean(FAR struct e1000_driver_s *priv);
 
 /* Common TX logic */
 
+static int e1000_transmit_batch(FAR struct netdev_lowerhalf_s *dev,
+                                FAR netpkt_t **pkts, int npkts);
 static int e1000_transmit(FAR struct netdev_lowerhalf_s *dev,
                           FAR netpkt_t *pkt);
 
 /* Interrupt handling */
 
+static int e1000_receive_batch(FAR struct netdev_lowerhalf_s *dev,
+                               FAR netpkt_t **pkts, int npkts);
 static FAR netpkt_t *e1000_receive(FAR struct netdev_lowerhalf_s *dev);
 static void e1000_txdone(FAR struct netdev_lowerhalf_s *dev);
 
@@ -293,17 +297,19 @@ static struct pci_driver_s g_e1000_drv =
 
 static const struct netdev_ops_s g_e1000_ops =
 {
-  .ifup     = e1000_ifup,
-  .ifdown   = e1000_ifdown,
-  .transmit = e1000_transmit,
-  .receive  = e1000_receive,
+  .ifup           = e1000_ifup,
+  .ifdown         = e1000_ifdown,
+  .transmit       = e1000_transmit,
+  .receive        = e1000_receive,
 #ifdef CONFIG_NET_MCASTGROUP
-  .addmac   = e1000_addmac,
-  .rmmac    = e1000_rmmac,
+  .addmac         = e1000_addmac,
+  .rmmac          = e1000_rmmac,
 #endif
 #if CONFIG_NETDEV_WORK_THREAD_POLLING_PERIOD > 0
-  .reclaim  = e1000_txdone,
+  .reclaim        = e1000_txdone,
 #endif
+  .transmit_batch = e1000_transmit_batch,
+  .receive_batch  = e1000_receive_batch,
 };
 
 /*****************************************************************************
@@ -539,64 +545,79 @@ static void e1000_rxclean(FAR struct e1000_driver_s *priv)
 }
 
 /*****************************************************************************
- * Name: e1000_transmit
+ * Name: e1000_transmit_batch
  *
  * Description:
- *   Start hardware transmission.  Called either from the txdone interrupt
- *   handling or from watchdog based polling.
+ *   Start hardware transmission of several packets.  The descriptors of all
+ *   the packets are set up before the TX tail is updated once.
  *
  * Input Parameters:
- *   priv - Reference to the driver state structure
+ *   dev   - Reference to the lower half driver structure
+ *   pkts  - The packets to send
+ *   npkts - The number of packets
  *
  * Returned Value:
- *   Return OK on success
+ *   The number of packets taken, or a negated errno value if none was.
  *
  * Assumptions:
  *   The network is locked.
  *
  *****************************************************************************/
 
-static int e1000_transmit(FAR struct netdev_lowerhalf_s *dev,
-                          FAR netpkt_t *pkt)
+static int e1000_transmit_batch(FAR struct netdev_lowerhalf_s *dev,
+                                FAR netpkt_t **pkts, int npkts)
 {
   FAR struct e1000_driver_s *priv = (FAR struct e1000_driver_s *)dev;
-  uint64_t                   pa   = 0;
-  int                        desc = priv->tx_now;
-  size_t                     len  = netpkt_getdatalen(dev, pkt);
-
-  ninfo("transmit\n");
-
-  /* Check the send length */
+  FAR netpkt_t              *pkt;
+  int                        desc;
+  size_t                     len;
+  int                        i;
 
-  if (len > E1000_PKTBUF_SIZE)
-    {
-      nerr("net transmit buffer too large\n");
-      return -EINVAL;
-    }
+  ninfo("transmit %d\n", npkts);
 
   if (!IFF_IS_RUNNING(dev->netdev.d_flags))
     {
       return -ENETDOWN;
     }
 
-  /* Store TX packet reference */
+  for (i = 0; i < npkts; i++)
+    {
+      pkt = pkts[i];
+      len = netpkt_getdatalen(dev, pkt);
+
+      /* Check the send length */
 
-  priv->tx_pkt[priv->tx_now] = pkt;
+      if (len > E1000_PKTBUF_SIZE)
+        {
+          nerr("net transmit buffer too large\n");
+          break;
+        }
 
-  /* Prepare next TX descriptor */
+      /* Store TX packet reference */
 
-  priv->tx_now = (priv->tx_now + 1) % E1000_TX_DESC;
+      desc = priv->tx_now;
+      priv->tx_pkt[desc] = pkt;
 
-  /* Setup TX descriptor */
+      /* Prepare next TX descriptor */
 
-  pa = up_addrenv_va_to_pa(netpkt_getdata(dev, pkt));
+      priv->tx_now = (priv->tx_now + 1) % E1000_TX_DESC;
 
-  priv->tx[desc].addr   = pa;
-  priv->tx[desc].len    = len;
-  priv->tx[desc].cmd    = (E1000_TDESC_CMD_EOP | E1000_TDESC_CMD_IFCS |
-                           E1000_TDESC_CMD_RS | E1000_TDESC_CMD_RPS);
-  priv->tx[desc].cso    = 0;
-  priv->tx[desc].status = 0;
+      /* Setup TX descriptor */
+
+      priv->tx[desc].addr   = up_addrenv_va_to_pa(netpkt_getdata(dev, pkt));
+      priv->tx[desc].len    = len;
+      priv->tx[desc].cmd    = (E1000_TDESC_CMD_EOP | E1000_TDESC_CMD_IFCS |
+                               E1000_TDESC_CMD_RS | E1000_TDESC_CMD_RPS);
+      priv->tx[desc].cso    = 0;
+      priv->tx[desc].status = 0;
+
+      ninfodumpbuffer("Transmitted:", netpkt_getdata(dev, pkt), len);
+    }
+
+  if (i == 0)
+    {
+      return -EINVAL;
+    }
 
   UP_DSB();
 
@@ -604,86 +625,150 @@ static int e1000_transmit(FAR struct netdev_lowerhalf_s *dev,
 
   e1000_putreg_mem(priv, E1000_TDT, priv->tx_now);
 
-  ninfodumpbuffer("Transmitted:", netpkt_getdata(dev, pkt), len);
-
-  return OK;
+  return i;
 }
 
 /*****************************************************************************
- * Name: e1000_receive
+ * Name: e1000_transmit
  *
  * Description:
- *   An interrupt was received indicating the availability of a new RX packet
+ *   Start hardware transmission.  Called either from the txdone interrupt
+ *   handling or from watchdog based polling.
  *
  * Input Parameters:
  *   priv - Reference to the driver state structure
  *
  * Returned Value:
- *   A pointer to received packet
+ *   Return OK on success
  *
  * Assumptions:
  *   The network is locked.
  *
  *****************************************************************************/
 
-static FAR netpkt_t *e1000_receive(FAR struct netdev_lowerhalf_s *dev)
+static int e1000_transmit(FAR struct netdev_lowerhalf_s *dev,
+                          FAR netpkt_t *pkt)
 {
-  FAR struct e1000_driver_s *priv = (FAR struct e1000_driver_s *)dev;
-  FAR netpkt_t              *pkt  = NULL;
-  FAR struct e1000_rx_leg_s *rx   = NULL;
-  int                        desc = desc = priv->rx_now;
+  int ret = e1000_transmit_batch(dev, &pkt, 1);
 
-  /* Get RX descriptor and RX packet */
+  return ret < 0 ? ret : OK;
+}
 
-  rx = &priv->rx[desc];
-  pkt = priv->rx_pkt[desc];
+/*****************************************************************************
+ * Name: e1000_receive_batch
+ *
+ * Description:
+ *   Take up to npkts received packets from the RX ring.  The RX tail is
+ *   updated once for all of them.
+ *
+ * Input Parameters:
+ *   dev   - Reference to the lower half driver structure
+ *   pkts  - Where to store the received packets
+ *   npkts - The maximum number of packets
+ *
+ * Returned Value:
+ *   The number of packets received
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ *****************************************************************************/
 
-  /* Check if descriptor done */
+static int e1000_receive_batch(FAR struct netdev_lowerhalf_s *dev,
+                               FAR netpkt_t **pkts, int npkts)
+{
+  FAR struct e1000_driver_s *priv = (FAR struct e1000_driver_s *)dev;
+  FAR netpkt_t              *pkt;
+  FAR struct e1000_rx_leg_s *rx;
+  int                        desc = -1;
+  int                        n    = 0;
+  uint8_t                    errors;
 
-  if (!(rx->status & E1000_RDESC_STATUS_DD))
+  while (n < npkts)
     {
-      return NULL;
-    }
+      /* Get RX descriptor and RX packet */
 
-  /* Next descriptor */
+      rx  = &priv->rx[priv->rx_now];
+      pkt = priv->rx_pkt[priv->rx_now];
 
-  priv->rx_now = (priv->rx_now + 1) % E1000_RX_DESC;
+      /* Check if descriptor done */
 
-  /* Allocate new rx packet */
+      if (!(rx->status & E1000_RDESC_STATUS_DD))
+        {
+          break;
+        }
 
-  priv->rx_pkt[desc] = netpkt_alloc(dev, NETPKT_RX);
-  if (priv->rx_pkt[desc] == NULL)
-    {
-      nerr("alloc pkt_new failed\n");
-      PANIC();
-    }
+      /* Next descriptor */
+
+      desc = priv->rx_now;
+      priv->rx_now = (priv->rx_now + 1) % E1000_RX_DESC;
 
-  /* Set packet length */
+      /* Allocate new rx packet */
 
-  netpkt_setdatalen(dev, pkt, rx->len);
+      priv->rx_pkt[desc] = netpkt_alloc(dev, NETPKT_RX);
+      if (priv->rx_pkt[desc] == NULL)
+        {
+          nerr("alloc pkt_new failed\n");
+          PANIC();
+        }
 
-  /* Store new packet in RX descriptor ring */
+      /* Set packet length */
 
-  rx->addr   = up_addrenv_va_to_pa(
-               netpkt_getdata(dev, priv->rx_pkt[desc]));
-  rx->len    = 0;
-  rx->status = 0;
+      netpkt_setdatalen(dev, pkt, rx->len);
+      errors = rx->errors;
 
-  /* Update RX tail */
+      /* Store new packet in RX descriptor ring */
 
-  e1000_putreg_mem(priv, E1000_RDT, desc);
+      rx->addr   = up_addrenv_va_to_pa(
+                   netpkt_getdata(dev, priv->rx_pkt[desc]));
+      rx->len    = 0;
+      rx->status = 0;
 
-  /* Handle errros */
+      /* Handle errros */
 
-  if (rx->errors)
+      if (errors)
+        {
+          nerr("RX error reported (%"PRIu8")\n", errors);
+          NETDEV_RXERRORS(&priv->dev.netdev);
+          netpkt_free(dev, pkt, NETPKT_RX);
+          continue;
+        }
+
+      pkts[n++] = pkt;
+    }
+
+  /* Update RX tail */
+
+  if (desc >= 0)
     {
-      nerr("RX error reported (%"PRIu8")\n", rx->errors);
-      NETDEV_RXERRORS(&priv->dev.netdev);
-      netpkt_free(dev, pkt, NETPKT_RX);
-      return NULL;
+      e1000_putreg_mem(priv, E1000_RDT, desc);
     }
 
-  return pkt;
+  return n;
+}
+
+/*****************************************************************************
+ * Name: e1000_receive
+ *
+ * Description:
+ *   An interrupt was received indicating the availability of a new RX packet
+ *
+ * Input Parameters:
+ *   priv - Reference to the driver state structure
+ *
+ * Returned Value:
+ *   A pointer to received packet
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ *****************************************************************************/
+
+static FAR netpkt_t *e1000_receive(FAR struct netdev_lowerhalf_s *dev)
+{
+  FAR netpkt_t *pkt;
+
+  return e1000_receive_batch(dev, &pkt, 1) > 0 ? pkt : NULL;
 }
 
 /*****************************************************************************
@@ -181,11 +181,15 @@ static void igc_rxclean(FAR struct igc_driver_s *priv);
 
 /* Common TX logic */
 
+static int igc_transmit_batch(FAR struct netdev_lowerhalf_s *dev,
+                              FAR netpkt_t **pkts, int npkts);
 static int igc_transmit(FAR struct netdev_lowerhalf_s *dev,
                         FAR netpkt_t *pkt);
 
 /* Interrupt handling */
 
+static int igc_receive_batch(FAR struct netdev_lowerhalf_s *dev,
+                             FAR netpkt_t **pkts, int npkts);
 static FAR netpkt_t *igc_receive(FAR struct netdev_lowerhalf_s *dev);
 static void igc_txdone(FAR struct netdev_lowerhalf_s *dev);
 
@@ -252,14 +256,16 @@ static struct pci_driver_s g_pci_igc_drv =
 
 static const struct netdev_ops_s g_igc_ops =
 {
-  .ifup     = igc_ifup,
-  .ifdown   = igc_ifdown,
-  .transmit = igc_transmit,
-  .receive  = igc_receive,
+  .ifup           = igc_ifup,
+  .ifdown         = igc_ifdown,
+  .transmit       = igc_transmit,
+  .receive        = igc_receive,
 #ifdef CONFIG_NET_MCASTGROUP
-  .addmac   = igc_addmac,
-  .rmmac    = igc_rmmac,
+  .addmac         = igc_addmac,
+  .rmmac          = igc_rmmac,
 #endif
+  .transmit_batch = igc_transmit_batch,
+  .receive_batch  = igc_receive_batch,
 };
 
 /*****************************************************************************
@@ -493,64 +499,79 @@ static void igc_rxclean(FAR struct igc_driver_s *priv)
 }
 
 /*****************************************************************************
- * Name: igc_transmit
+ * Name: igc_transmit_batch
  *
  * Description:
- *   Start hardware transmission.  Called either from the txdone interrupt
- *   handling or from watchdog based polling.
+ *   Start hardware transmission of several packets.  The descriptors of all
+ *   the packets are set up before the TX tail is updated once.
  *
  * Input Parameters:
- *   priv - Reference to the driver state structure
+ *   dev   - Reference to the lower half driver structure
+ *   pkts  - The packets to send
+ *   npkts - The number of packets
  *
  * Returned Value:
- *   None
+ *   The number of packets taken, or a negated errno value if none was.
  *
  * Assumptions:
  *   The network is locked.
  *
  *****************************************************************************/
 
-static int igc_transmit(FAR struct netdev_lowerhalf_s *dev,
-                          FAR netpkt_t *pkt)
+static int igc_transmit_batch(FAR struct netdev_lowerhalf_s *dev,
+                              FAR netpkt_t **pkts, int npkts)
 {
   FAR struct igc_driver_s *priv = (FAR struct igc_driver_s *)dev;
-  uint64_t                 pa   = 0;
-  int                      desc = priv->tx_now;
-  size_t                   len  = netpkt_getdatalen(dev, pkt);
+  FAR netpkt_t            *pkt;
+  int                      desc;
+  size_t                   len;
+  int                      i;
 
-  ninfo("transmit\n");
-
-  /* Check the send length */
-
-  if (len > IGC_PKTBUF_SIZE)
-    {
-      nerr("net transmit buffer too large\n");
-      return -EINVAL;
-    }
+  ninfo("transmit %d\n", npkts);
 
   if (!IFF_IS_RUNNING(dev->netdev.d_flags))
     {
       return -ENETDOWN;
     }
 
-  /* Store TX packet reference */
+  for (i = 0; i < npkts; i++)
+    {
+      pkt = pkts[i];
+      len = netpkt_getdatalen(dev, pkt);
+
+      /* Check the send length */
 
-  priv->tx_pkt[priv->tx_now] = pkt;
+      if (len > IGC_PKTBUF_SIZE)
+        {
+          nerr("net transmit buffer too large\n");
+          break;
+        }
 
-  /* Prepare next TX descriptor */
+      /* Store TX packet reference */
 
-  priv->tx_now = (priv->tx_now + 1) % IGC_TX_DESC;
+      desc = priv->tx_now;
+      priv->tx_pkt[desc] = pkt;
 
-  /* Setup TX descriptor */
+      /* Prepare next TX descriptor */
 
-  pa = up_addrenv_va_to_pa(netpkt_getdata(dev, pkt));
+      priv->tx_now = (priv->tx_now + 1) % IGC_TX_DESC;
 
-  priv->tx[desc].addr   = pa;
-  priv->tx[desc].len    = len;
-  priv->tx[desc].cmd    = (IGC_TDESC_CMD_EOP | IGC_TDESC_CMD_IFCS |
-                           IGC_TDESC_CMD_RS);
-  priv->tx[desc].cso    = 0;
-  priv->tx[desc].status = 0;
+      /* Setup TX descriptor */
+
+      priv->tx[desc].addr   = up_addrenv_va_to_pa(netpkt_getdata(dev, pkt));
+      priv->tx[desc].len    = len;
+      priv->tx[desc].cmd    = (IGC_TDESC_CMD_EOP | IGC_TDESC_CMD_IFCS |
+                               IGC_TDESC_CMD_RS);
+      priv->tx[desc].cso    = 0;
+      priv->tx[desc].status = 0;
+
+      ninfodumpbuffer("Transmitted:", netpkt_getdata(dev, pkt), len);
+    }
+
+  if (i == 0)
+    {
+      return -EINVAL;
+    }
 
   UP_DSB();
 
@@ -558,16 +579,15 @@ static int igc_transmit(FAR struct netdev_lowerhalf_s *dev,
 
   igc_putreg_mem(priv, IGC_TDT0, priv->tx_now);
 
-  ninfodumpbuffer("Transmitted:", netpkt_getdata(dev, pkt), len);
-
-  return OK;
+  return i;
 }
 
 /*****************************************************************************
- * Name: igc_receive
+ * Name: igc_transmit
  *
  * Description:
- *   An interrupt was received indicating the availability of a new RX packet
+ *   Start hardware transmission.  Called either from the txdone interrupt
+ *   handling or from watchdog based polling.
  *
  * Input Parameters:
  *   priv - Reference to the driver state structure
@@ -580,66 +600,129 @@ static int igc_transmit(FAR struct netdev_lowerhalf_s *dev,
  *
  *****************************************************************************/
 
-static FAR netpkt_t * igc_receive(FAR struct netdev_lowerhalf_s *dev)
+static int igc_transmit(FAR struct netdev_lowerhalf_s *dev,
+                        FAR netpkt_t *pkt)
+{
+  int ret = igc_transmit_batch(dev, &pkt, 1);
+
+  return ret < 0 ? ret : OK;
+}
+
+/*****************************************************************************
+ * Name: igc_receive_batch
+ *
+ * Description:
+ *   Take up to npkts received packets from the RX ring.  The RX tail is
+ *   updated once for all of them.
+ *
+ * Input Parameters:
+ *   dev   - Reference to the lower half driver structure
+ *   pkts  - Where to store the received packets
+ *   npkts - The maximum number of packets
+ *
+ * Returned Value:
+ *   The number of packets received
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ *****************************************************************************/
+
+static int igc_receive_batch(FAR struct netdev_lowerhalf_s *dev,
+                             FAR netpkt_t **pkts, int npkts)
 {
   FAR struct igc_driver_s *priv = (FAR struct igc_driver_s *)dev;
-  FAR netpkt_t            *pkt  = NULL;
-  FAR struct igc_rx_leg_s *rx   = NULL;
-  int                      desc = 0;
+  FAR netpkt_t            *pkt;
+  FAR struct igc_rx_leg_s *rx;
+  int                      desc = -1;
+  int                      n    = 0;
+  uint8_t                  errors;
 
-  desc = priv->rx_now;
+  while (n < npkts)
+    {
+      /* Get RX descriptor and RX packet */
 
-  /* Get RX descriptor and RX packet */
+      rx  = &priv->rx[priv->rx_now];
+      pkt = priv->rx_pkt[priv->rx_now];
 
-  rx = &priv->rx[desc];
-  pkt = priv->rx_pkt[desc];
+      /* Check if descriptor done */
 
-  /* Check if descriptor done */
+      if (!(rx->status & IGC_RDESC_STATUS_DD))
+        {
+          break;
+        }
 
-  if (!(rx->status & IGC_RDESC_STATUS_DD))
-    {
-      return NULL;
-    }
+      /* Next descriptor */
 
-  /* Next descriptor */
+      desc = priv->rx_now;
+      priv->rx_now = (priv->rx_now + 1) % IGC_RX_DESC;
 
-  priv->rx_now = (priv->rx_now + 1) % IGC_RX_DESC;
+      /* Allocate new rx packet */
 
-  /* Allocate new rx packet */
+      priv->rx_pkt[desc] = netpkt_alloc(dev, NETPKT_RX);
+      if (priv->rx_pkt[desc] == NULL)
+        {
+          nerr("alloc pkt_new failed\n");
+          PANIC();
+        }
 
-  priv->rx_pkt[desc] = netpkt_alloc(dev, NETPKT_RX);
-  if (priv->rx_pkt[desc] == NULL)
-    {
-      nerr("alloc pkt_new failed\n");
-      PANIC();
-    }
+      /* Set packet length */
 
-  /* Set packet length */
+      netpkt_setdatalen(dev, pkt, rx->len);
+      errors = rx->errors;
 
-  netpkt_setdatalen(dev, pkt, rx->len);
+      /* Store new packet in RX descriptor ring */
 
-  /* Store new packet in RX descriptor ring */
+      rx->addr   = up_addrenv_va_to_pa(
+                   netpkt_getdata(dev, priv->rx_pkt[desc]));
+      rx->len    = 0;
+      rx->status = 0;
 
-  rx->addr   = up_addrenv_va_to_pa(
-               netpkt_getdata(dev, priv->rx_pkt[desc]));
-  rx->len    = 0;
-  rx->status = 0;
+      /* Handle errros */
 
-  /* Update RX tail */
+      if (errors)
+        {
+          nerr("RX error reported (%"PRIu8")\n", errors);
+          NETDEV_RXERRORS(&priv->dev);
+          netpkt_free(dev, pkt, NETPKT_RX);
+          continue;
+        }
 
-  igc_putreg_mem(priv, IGC_RDT0, desc);
+      pkts[n++] = pkt;
+    }
 
-  /* Handle errros */
+  /* Update RX tail */
 
-  if (rx->errors)
+  if (desc >= 0)
     {
-      nerr("RX error reported (%"PRIu8")\n", rx->errors);
-      NETDEV_RXERRORS(&priv->dev);
-      netpkt_free(dev, pkt, NETPKT_RX);
-      return NULL;
+      igc_putreg_mem(priv, IGC_RDT0, desc);
     }
 
-  return pkt;
+  return n;
+}
+
+/*****************************************************************************
+ * Name: igc_receive
+ *
+ * Description:
+ *   An interrupt was received indicating the availability of a new RX packet
+ *
+ * Input Parameters:
+ *   priv - Reference to the driver state structure
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ *****************************************************************************/
+
+static FAR netpkt_t *igc_receive(FAR struct netdev_lowerhalf_s *dev)
+{
+  FAR netpkt_t *pkt;
+
+  return igc_receive_batch(dev, &pkt, 1) > 0 ? pkt : NULL;
 }
 
 /*****************************************************************************
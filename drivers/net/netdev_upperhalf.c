@@ -87,6 +87,11 @@ struct netdev_upperhalf_s
 #if CONFIG_IOB_NCHAINS > 0
   struct iob_queue_s txq;
 #endif
+
+  /* TX packets waiting to be handed to transmit_batch in one burst */
+
+  FAR netpkt_t *txbatch[CONFIG_NETDEV_BATCH_SIZE];
+  int ntxbatch;
 };
 
 /****************************************************************************
@@ -248,6 +253,58 @@ static inline bool netdev_upper_can_tx(FAR struct netdev_upperhalf_s *upper)
   return quota > 0;
 }
 
+/****************************************************************************
+ * Name: netdev_upper_txflush
+ *
+ * Description:
+ *   Hand the TX packets held by netdev_upper_txpoll() to the lower half
+ *   with transmit_batch().  A packet it refuses is dropped, as a packet
+ *   refused by transmit() is, and the rest of the burst is retried.
+ *
+ * Input Parameters:
+ *   upper - Reference to the upper half driver structure
+ *
+ * Returned Value:
+ *   OK if all the packets were taken, otherwise the negated errno value of
+ *   the first refusal.
+ *
+ * Assumptions:
+ *   Called with the network locked.
+ *
+ ****************************************************************************/
+
+static int netdev_upper_txflush(FAR struct netdev_upperhalf_s *upper)
+{
+  FAR struct netdev_lowerhalf_s *lower = upper->lower;
+  int                            err   = OK;
+  int                            ret;
+  int                            i     = 0;
+
+  while (i < upper->ntxbatch)
+    {
+      ret = lower->ops->transmit_batch(lower, &upper->txbatch[i],
+                                       upper->ntxbatch - i);
+      if (ret > 0)
+        {
+          i += ret;
+          continue;
+        }
+
+      /* The lower half refused the first packet left, drop only that one */
+
+      NETDEV_TXERRORS(&lower->netdev);
+      netpkt_free(lower, upper->txbatch[i++], NETPKT_TX);
+
+      if (err == OK)
+        {
+          err = ret < 0 ? ret : -EBUSY;
+        }
+    }
+
+  upper->ntxbatch = 0;
+  return err;
+}
+
 /****************************************************************************
  * Name: netdev_upper_txpoll
  *
@@ -297,6 +354,19 @@ static int netdev_upper_txpoll(FAR struct net_driver_s *dev)
       nerr("ERROR: Packet too long to send!\n");
       ret = -EMSGSIZE;
     }
+  else if (lower->ops->transmit_batch != NULL)
+    {
+      /* Hold the packet until the burst is full or the poll is over */
+
+      upper->txbatch[upper->ntxbatch++] = pkt;
+      if (upper->ntxbatch < CONFIG_NETDEV_BATCH_SIZE)
+        {
+          return NETDEV_TX_CONTINUE;
+        }
+
+      ret = netdev_upper_txflush(upper);
+      return ret < 0 ? ret : NETDEV_TX_CONTINUE;
+    }
   else
     {
       ret = lower->ops->transmit(lower, pkt);
@@ -380,6 +450,13 @@ static void netdev_upper_txavail_work(FAR struct netdev_upperhalf_s *upper)
       while (netdev_upper_can_tx(upper) &&
              netdev_upper_tx(dev) == NETDEV_TX_CONTINUE);
     }
+
+  /* Send the rest of the burst */
+
+  if (upper->ntxbatch > 0)
+    {
+      netdev_upper_txflush(upper);
+    }
 }
 
 /****************************************************************************
@@ -584,79 +661,122 @@ static void ip_input(FAR struct net_driver_s *dev)
 #endif
 
 /****************************************************************************
- * Function: netdev_upper_rxpoll_work
+ * Function: netdev_upper_input
  *
  * Description:
- *   Try to receive packets from device and pass packets into IP
- *   stack and send packets which is from IP stack if necessary.
+ *   Pass a received packet into the network stack.
  *
  * Input Parameters:
  *   upper - Reference to the upper half driver structure
+ *   pkt   - The received packet
  *
  * Assumptions:
  *   Called with the network locked.
  *
  ****************************************************************************/
 
-static void netdev_upper_rxpoll_work(FAR struct netdev_upperhalf_s *upper)
+static void netdev_upper_input(FAR struct netdev_upperhalf_s *upper,
+                               FAR netpkt_t *pkt)
 {
   FAR struct netdev_lowerhalf_s *lower = upper->lower;
   FAR struct net_driver_s       *dev   = &lower->netdev;
-  FAR netpkt_t                  *pkt;
-
-  /* Loop while receive() successfully retrieves valid Ethernet frames. */
 
-  while ((pkt = lower->ops->receive(lower)) != NULL)
+  if (!IFF_IS_UP(dev->d_flags))
     {
-      if (!IFF_IS_UP(dev->d_flags))
-        {
-          /* Interface down, drop frame */
+      /* Interface down, drop frame */
 
-          NETDEV_RXDROPPED(dev);
-          netpkt_free(lower, pkt, NETPKT_RX);
-          continue;
-        }
+      NETDEV_RXDROPPED(dev);
+      netpkt_free(lower, pkt, NETPKT_RX);
+      return;
+    }
 
-      netpkt_put(dev, pkt, NETPKT_RX);
-      NETDEV_RXPACKETS(dev);
+  netpkt_put(dev, pkt, NETPKT_RX);
+  NETDEV_RXPACKETS(dev);
 
 #ifdef CONFIG_NET_PKT
-      /* When packet sockets are enabled, feed the frame into the tap */
+  /* When packet sockets are enabled, feed the frame into the tap */
 
-      pkt_input(dev);
+  pkt_input(dev);
 #endif
 
-      switch (dev->d_lltype)
-        {
+  switch (dev->d_lltype)
+    {
 #ifdef CONFIG_NET_LOOPBACK
-        case NET_LL_LOOPBACK:
+    case NET_LL_LOOPBACK:
 #endif
 #ifdef CONFIG_NET_ETHERNET
-        case NET_LL_ETHERNET:
+    case NET_LL_ETHERNET:
 #endif
 #ifdef CONFIG_DRIVERS_IEEE80211
-        case NET_LL_IEEE80211:
+    case NET_LL_IEEE80211:
 #endif
 #if defined(CONFIG_NET_LOOPBACK) || defined(CONFIG_NET_ETHERNET) || \
     defined(CONFIG_DRIVERS_IEEE80211)
-          eth_input(dev);
-          break;
+      eth_input(dev);
+      break;
 #endif
 #ifdef CONFIG_NET_MBIM
-        case NET_LL_MBIM:
-          ip_input(dev);
-          break;
+    case NET_LL_MBIM:
+      ip_input(dev);
+      break;
 #endif
 #ifdef CONFIG_NET_CAN
-        case NET_LL_CAN:
-          ninfo("CAN frame");
-          can_input(dev);
-          break;
+    case NET_LL_CAN:
+      ninfo("CAN frame");
+      can_input(dev);
+      break;
 #endif
-        default:
-          nerr("Unknown link type %d\n", dev->d_lltype);
-          break;
+    default:
+      nerr("Unknown link type %d\n", dev->d_lltype);
+      break;
+    }
+}
+
+/****************************************************************************
+ * Function: netdev_upper_rxpoll_work
+ *
+ * Description:
+ *   Try to receive packets from device and pass packets into IP
+ *   stack and send packets which is from IP stack if necessary.
+ *   The packets are taken in bursts if the lower half supports it.
+ *
+ * Input Parameters:
+ *   upper - Reference to the upper half driver structure
+ *
+ * Assumptions:
+ *   Called with the network locked.
+ *
+ ****************************************************************************/
+
+static void netdev_upper_rxpoll_work(FAR struct netdev_upperhalf_s *upper)
+{
+  FAR struct netdev_lowerhalf_s *lower = upper->lower;
+  FAR netpkt_t                  *pkts[CONFIG_NETDEV_BATCH_SIZE];
+  FAR netpkt_t                  *pkt;
+  int                            npkts;
+  int                            i;
+
+  if (lower->ops->receive_batch != NULL)
+    {
+      do
+        {
+          npkts = lower->ops->receive_batch(lower, pkts,
+                                            CONFIG_NETDEV_BATCH_SIZE);
+          for (i = 0; i < npkts; i++)
+            {
+              netdev_upper_input(upper, pkts[i]);
+            }
         }
+      while (npkts > 0);
+
+      return;
+    }
+
+  /* Loop while receive() successfully retrieves valid Ethernet frames. */
+
+  while ((pkt = lower->ops->receive(lower)) != NULL)
+    {
+      netdev_upper_input(upper, pkt);
     }
 }
 
@@ -33,6 +33,7 @@
 #include <errno.h>
 #include <stdio.h>
 #include <string.h>
+#include <strings.h>
 #include <inttypes.h>
 #include <poll.h>
 
@@ -72,10 +73,37 @@
 #define get_task_state(s)                                                    \
   ((s) == 0 ? 'X' : ((s) <= LAST_READY_TO_RUN_STATE ? 'R' : 'S'))
 
+/* Size of the ring of each CPU, the largest power of two that fits in its
+ * share of the buffer.
+ */
+
+#ifdef CONFIG_DRIVERS_NOTERAM_PERCPU
+#  define noteram_ringsize(drv) \
+     (1u << (fls((int)((drv)->ni_bufsize / NCPUS)) - 1))
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
 
+#ifdef CONFIG_DRIVERS_NOTERAM_PERCPU
+/* The ring of one CPU.  Only that CPU writes notes to it, with interrupts
+ * disabled, and it is the only one to move nr_head and nr_tail.  Only the
+ * readers move nr_read and nr_start; after a clear, the writer moves
+ * nr_tail up to nr_start.  All four are free-running byte counts.
+ */
+
+struct noteram_ring_s
+{
+  volatile unsigned int nr_head;    /* End of the last note */
+  volatile unsigned int nr_tail;    /* Start of the oldest note */
+  unsigned int nr_read;             /* Start of the next note to read */
+  volatile unsigned int nr_start;   /* Start of the notes after a clear */
+  unsigned long nr_dropped;         /* Notes dropped when full */
+  unsigned long nr_overwritten;     /* Notes overwritten when full */
+};
+#endif
+
 struct noteram_driver_s
 {
   struct note_driver_s driver;
@@ -87,6 +115,11 @@ struct noteram_driver_s
   volatile unsigned int ni_read;
   spinlock_t lock;
   FAR struct pollfd *pfd;
+  unsigned long ni_dropped;
+  unsigned long ni_overwritten;
+#ifdef CONFIG_DRIVERS_NOTERAM_PERCPU
+  struct noteram_ring_s ni_ring[NCPUS];
+#endif
 };
 
 /* The structure to hold the context data of trace dump */
@@ -187,6 +220,8 @@ struct noteram_driver_s g_noteram_driver =
  * Private Functions
  ****************************************************************************/
 
+#ifndef CONFIG_DRIVERS_NOTERAM_PERCPU
+
 /****************************************************************************
  * Name: noteram_buffer_clear
  *
@@ -420,6 +455,465 @@ static ssize_t noteram_get(FAR struct noteram_driver_s *drv,
   return notelen;
 }
 
+/****************************************************************************
+ * Name: noteram_rewind
+ *
+ * Description:
+ *   Read again the oldest note of the circular buffer.
+ *
+ ****************************************************************************/
+
+static void noteram_rewind(FAR struct noteram_driver_s *drv)
+{
+  drv->ni_read = drv->ni_tail;
+}
+
+/****************************************************************************
+ * Name: noteram_add
+ *
+ * Description:
+ *   Add the variable length note to the transport layer
+ *
+ * Input Parameters:
+ *   note    - The note buffer
+ *   notelen - The buffer length
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   We are within a critical section.
+ *
+ ****************************************************************************/
+
+static void noteram_add(FAR struct note_driver_s *driver,
+                        FAR const void *note, size_t notelen)
+{
+  FAR const char *buf = note;
+  FAR struct noteram_driver_s *drv = (FAR struct noteram_driver_s *)driver;
+  unsigned int head;
+  unsigned int remain;
+  unsigned int space;
+  irqstate_t flags;
+
+  flags = spin_lock_irqsave_notrace(&drv->lock);
+
+  if (drv->ni_overwrite == NOTERAM_MODE_OVERWRITE_OVERFLOW)
+    {
+      drv->ni_dropped++;
+      spin_unlock_irqrestore_notrace(&drv->lock, flags);
+      return;
+    }
+
+  DEBUGASSERT(note != NULL && notelen < drv->ni_bufsize);
+  remain = drv->ni_bufsize - noteram_length(drv);
+
+  if (remain <= NOTE_ALIGN(notelen))
+    {
+      if (drv->ni_overwrite == NOTERAM_MODE_OVERWRITE_DISABLE)
+        {
+          /* Stop recording if not in overwrite mode */
+
+          drv->ni_overwrite = NOTERAM_MODE_OVERWRITE_OVERFLOW;
+          drv->ni_dropped++;
+          spin_unlock_irqrestore_notrace(&drv->lock, flags);
+          return;
+        }
+
+      /* Remove the note at the tail index , make sure there is enough space
+       */
+
+      do
+        {
+          if (drv->ni_read == drv->ni_tail)
+            {
+              drv->ni_overwritten++;
+            }
+
+          noteram_remove(drv);
+          remain = drv->ni_bufsize - noteram_length(drv);
+        }
+      while (remain <= NOTE_ALIGN(notelen));
+    }
+
+  head = drv->ni_head;
+  space = drv->ni_bufsize - head;
+  space = space < notelen ? space : notelen;
+  memcpy(drv->ni_buffer + head, note, space);
+  memcpy(drv->ni_buffer, buf + space, notelen - space);
+  drv->ni_head = noteram_next(drv, head, NOTE_ALIGN(notelen));
+  spin_unlock_irqrestore_notrace(&drv->lock, flags);
+  poll_notify(&drv->pfd, 1, POLLIN);
+}
+
+/****************************************************************************
+ * Name: noteram_getstats
+ *
+ * Description:
+ *   Return the count of notes dropped or overwritten because the circular
+ *   buffer was full.
+ *
+ ****************************************************************************/
+
+static void noteram_getstats(FAR struct noteram_driver_s *drv,
+                             FAR struct noteram_stats_s *stats)
+{
+  stats->ns_dropped     = drv->ni_dropped;
+  stats->ns_overwritten = drv->ni_overwritten;
+}
+
+#else /* CONFIG_DRIVERS_NOTERAM_PERCPU */
+
+/****************************************************************************
+ * Name: noteram_ring_copy
+ *
+ * Description:
+ *   Copy data out of the ring of a CPU, handling wraparound.
+ *
+ ****************************************************************************/
+
+static void noteram_ring_copy(FAR struct noteram_driver_s *drv, int cpu,
+                              unsigned int ndx, FAR uint8_t *buffer,
+                              size_t len)
+{
+  unsigned int size = noteram_ringsize(drv);
+  FAR uint8_t *ring = drv->ni_buffer + cpu * size;
+  unsigned int space;
+
+  ndx &= size - 1;
+  space = size - ndx;
+  space = space < len ? space : len;
+  memcpy(buffer, ring + ndx, space);
+  memcpy(buffer + space, ring, len - space);
+}
+
+/****************************************************************************
+ * Name: noteram_ring_peek
+ *
+ * Description:
+ *   Get the common part of the next note to read from the ring of a CPU,
+ *   skipping the notes that were overwritten since the last read.
+ *
+ * Returned Value:
+ *   false if there is no note to read.
+ *
+ * Assumptions:
+ *   The caller holds the spinlock of the driver, which serializes the
+ *   readers.
+ *
+ ****************************************************************************/
+
+static bool noteram_ring_peek(FAR struct noteram_driver_s *drv, int cpu,
+                              FAR struct note_common_s *note)
+{
+  FAR struct noteram_ring_s *ring = &drv->ni_ring[cpu];
+  unsigned int head;
+  unsigned int read;
+
+  for (; ; )
+    {
+      head = ring->nr_head;
+      UP_DMB();
+
+      read = ring->nr_read;
+      if ((int)(ring->nr_tail - read) > 0)
+        {
+          read = ring->nr_tail;
+          ring->nr_read = read;
+        }
+
+      if (read == head)
+        {
+          return false;
+        }
+
+      noteram_ring_copy(drv, cpu, read, (FAR uint8_t *)note, sizeof(*note));
+      UP_DMB();
+
+      /* The note is valid if its CPU did not overwrite it meanwhile */
+
+      if ((int)(ring->nr_tail - read) <= 0)
+        {
+          return true;
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: noteram_buffer_clear
+ *
+ * Description:
+ *   Clear all contents of the rings.
+ *
+ ****************************************************************************/
+
+static void noteram_buffer_clear(FAR struct noteram_driver_s *drv)
+{
+  int cpu;
+
+  for (cpu = 0; cpu < NCPUS; cpu++)
+    {
+      FAR struct noteram_ring_s *ring = &drv->ni_ring[cpu];
+
+      ring->nr_start = ring->nr_head;
+      ring->nr_read  = ring->nr_start;
+    }
+
+  if (drv->ni_overwrite == NOTERAM_MODE_OVERWRITE_OVERFLOW)
+    {
+      drv->ni_overwrite = NOTERAM_MODE_OVERWRITE_DISABLE;
+    }
+}
+
+/****************************************************************************
+ * Name: noteram_unread_length
+ *
+ * Description:
+ *   Length of unread data currently in the rings, including notes that
+ *   may be overwritten before they are read.
+ *
+ ****************************************************************************/
+
+static unsigned int noteram_unread_length(FAR struct noteram_driver_s *drv)
+{
+  unsigned int length = 0;
+  int cpu;
+
+  for (cpu = 0; cpu < NCPUS; cpu++)
+    {
+      FAR struct noteram_ring_s *ring = &drv->ni_ring[cpu];
+
+      length += ring->nr_head - ring->nr_read;
+    }
+
+  return length;
+}
+
+/****************************************************************************
+ * Name: noteram_get
+ *
+ * Description:
+ *   Get the oldest unread note of all the rings.
+ *
+ * Input Parameters:
+ *   buffer - Location to return the next note
+ *   buflen - The length of the user provided buffer.
+ *
+ * Returned Value:
+ *   On success, the positive, non-zero length of the return note is
+ *   provided.  Zero is returned only if the rings are empty.  A negated
+ *   errno value is returned in the event of any failure.
+ *
+ ****************************************************************************/
+
+static ssize_t noteram_get(FAR struct noteram_driver_s *drv,
+                           FAR uint8_t *buffer, size_t buflen)
+{
+  struct note_common_s note;
+  FAR struct noteram_ring_s *ring;
+  clock_t systime = 0;
+  size_t notelen = 0;
+  unsigned int read;
+  int found;
+  int cpu;
+
+  DEBUGASSERT(buffer != NULL);
+
+  for (; ; )
+    {
+      /* Merge the rings by the timestamps of their next notes */
+
+      found = -1;
+      for (cpu = 0; cpu < NCPUS; cpu++)
+        {
+          if (noteram_ring_peek(drv, cpu, &note) &&
+              (found < 0 || (sclock_t)(note.nc_systime - systime) < 0))
+            {
+              found   = cpu;
+              systime = note.nc_systime;
+              notelen = note.nc_length;
+            }
+        }
+
+      if (found < 0)
+        {
+          return 0;
+        }
+
+      ring = &drv->ni_ring[found];
+      read = ring->nr_read;
+
+      /* Is the user buffer large enough to hold the note? */
+
+      if (buflen < notelen)
+        {
+          /* Skip the large note so that we do not get constipated. */
+
+          ring->nr_read = read + NOTE_ALIGN(notelen);
+          return -EFBIG;
+        }
+
+      noteram_ring_copy(drv, found, read, buffer, notelen);
+      UP_DMB();
+
+      /* Start over if the note was overwritten while being copied */
+
+      if ((int)(ring->nr_tail - read) <= 0)
+        {
+          ring->nr_read = read + NOTE_ALIGN(notelen);
+          return notelen;
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: noteram_rewind
+ *
+ * Description:
+ *   Read again the oldest notes of the rings.
+ *
+ ****************************************************************************/
+
+static void noteram_rewind(FAR struct noteram_driver_s *drv)
+{
+  int cpu;
+
+  for (cpu = 0; cpu < NCPUS; cpu++)
+    {
+      FAR struct noteram_ring_s *ring = &drv->ni_ring[cpu];
+
+      ring->nr_read = ring->nr_start;
+    }
+}
+
+/****************************************************************************
+ * Name: noteram_add
+ *
+ * Description:
+ *   Add the variable length note to the ring of this CPU.  This does not
+ *   take the spinlock of the driver, so that the CPUs do not serialize each
+ *   other.  Disabling the interrupts is enough to own the ring.
+ *
+ * Input Parameters:
+ *   note    - The note buffer
+ *   notelen - The buffer length
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+static void noteram_add(FAR struct note_driver_s *driver,
+                        FAR const void *note, size_t notelen)
+{
+  FAR struct noteram_driver_s *drv = (FAR struct noteram_driver_s *)driver;
+  FAR const uint8_t *buf = note;
+  FAR struct noteram_ring_s *ring;
+  FAR uint8_t *buffer;
+  unsigned int length = NOTE_ALIGN(notelen);
+  unsigned int size = noteram_ringsize(drv);
+  unsigned int head;
+  unsigned int tail;
+  unsigned int space;
+  irqstate_t flags;
+  int cpu;
+
+  DEBUGASSERT(note != NULL && notelen < size);
+
+  flags  = up_irq_save();
+  cpu    = this_cpu();
+  ring   = &drv->ni_ring[cpu];
+  buffer = drv->ni_buffer + cpu * size;
+
+  if (drv->ni_overwrite == NOTERAM_MODE_OVERWRITE_OVERFLOW)
+    {
+      ring->nr_dropped++;
+      up_irq_restore(flags);
+      return;
+    }
+
+  head = ring->nr_head;
+  tail = ring->nr_tail;
+
+  /* The notes before the last clear are discarded, their space is free */
+
+  if ((int)(ring->nr_start - tail) > 0)
+    {
+      tail          = ring->nr_start;
+      ring->nr_tail = tail;
+    }
+
+  if (size - (head - tail) < length)
+    {
+      if (drv->ni_overwrite == NOTERAM_MODE_OVERWRITE_DISABLE)
+        {
+          /* Stop recording if not in overwrite mode */
+
+          drv->ni_overwrite = NOTERAM_MODE_OVERWRITE_OVERFLOW;
+          ring->nr_dropped++;
+          up_irq_restore(flags);
+          return;
+        }
+
+      /* Remove the oldest notes, counting those not read yet.  The readers
+       * must see the new tail before these notes are overwritten.
+       */
+
+      do
+        {
+          if ((int)(tail - ring->nr_read) >= 0)
+            {
+              ring->nr_overwritten++;
+            }
+
+          tail += NOTE_ALIGN(buffer[tail & (size - 1)]);
+        }
+      while (size - (head - tail) < length);
+
+      ring->nr_tail = tail;
+      UP_DMB();
+    }
+
+  head &= size - 1;
+  space = size - head;
+  space = space < notelen ? space : notelen;
+  memcpy(buffer + head, buf, space);
+  memcpy(buffer, buf + space, notelen - space);
+
+  /* Publish the note */
+
+  UP_DMB();
+  ring->nr_head += length;
+  up_irq_restore(flags);
+  poll_notify(&drv->pfd, 1, POLLIN);
+}
+
+/****************************************************************************
+ * Name: noteram_getstats
+ *
+ * Description:
+ *   Return the count of notes dropped or overwritten because a ring was
+ *   full.
+ *
+ ****************************************************************************/
+
+static void noteram_getstats(FAR struct noteram_driver_s *drv,
+                             FAR struct noteram_stats_s *stats)
+{
+  int cpu;
+
+  stats->ns_dropped     = 0;
+  stats->ns_overwritten = 0;
+
+  for (cpu = 0; cpu < NCPUS; cpu++)
+    {
+      stats->ns_dropped     += drv->ni_ring[cpu].nr_dropped;
+      stats->ns_overwritten += drv->ni_ring[cpu].nr_overwritten;
+    }
+}
+
+#endif /* CONFIG_DRIVERS_NOTERAM_PERCPU */
+
 /****************************************************************************
  * Name: noteram_open
  ****************************************************************************/
@@ -432,7 +926,7 @@ static int noteram_open(FAR struct file *filep)
 
   /* Reset the read index of the circular buffer */
 
-  drv->ni_read = drv->ni_tail;
+  noteram_rewind(drv);
   ctx = kmm_zalloc(sizeof(*ctx));
   if (ctx == NULL)
     {
@@ -596,6 +1090,23 @@ static int noteram_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
           }
         break;
 
+      /* NOTERAM_GETSTATS
+       *      - Get the count of notes lost because the buffer was full
+       *        Argument: A writable pointer to struct noteram_stats_s
+       */
+
+      case NOTERAM_GETSTATS:
+        if (arg == 0)
+          {
+            ret = -EINVAL;
+          }
+        else
+          {
+            noteram_getstats(drv, (FAR struct noteram_stats_s *)arg);
+            ret = OK;
+          }
+        break;
+
       default:
           break;
     }
@@ -670,77 +1181,6 @@ errout:
   return ret;
 }
 
-/****************************************************************************
- * Name: noteram_add
- *
- * Description:
- *   Add the variable length note to the transport layer
- *
- * Input Parameters:
- *   note    - The note buffer
- *   notelen - The buffer length
- *
- * Returned Value:
- *   None
- *
- * Assumptions:
- *   We are within a critical section.
- *
- ****************************************************************************/
-
-static void noteram_add(FAR struct note_driver_s *driver,
-                        FAR const void *note, size_t notelen)
-{
-  FAR const char *buf = note;
-  FAR struct noteram_driver_s *drv = (FAR struct noteram_driver_s *)driver;
-  unsigned int head;
-  unsigned int remain;
-  unsigned int space;
-  irqstate_t flags;
-
-  flags = spin_lock_irqsave_notrace(&drv->lock);
-
-  if (drv->ni_overwrite == NOTERAM_MODE_OVERWRITE_OVERFLOW)
-    {
-      spin_unlock_irqrestore_notrace(&drv->lock, flags);
-      return;
-    }
-
-  DEBUGASSERT(note != NULL && notelen < drv->ni_bufsize);
-  remain = drv->ni_bufsize - noteram_length(drv);
-
-  if (remain <= NOTE_ALIGN(notelen))
-    {
-      if (drv->ni_overwrite == NOTERAM_MODE_OVERWRITE_DISABLE)
-        {
-          /* Stop recording if not in overwrite mode */
-
-          drv->ni_overwrite = NOTERAM_MODE_OVERWRITE_OVERFLOW;
-          spin_unlock_irqrestore_notrace(&drv->lock, flags);
-          return;
-        }
-
-      /* Remove the note at the tail index , make sure there is enough space
-       */
-
-      do
-        {
-          noteram_remove(drv);
-          remain = drv->ni_bufsize - noteram_length(drv);
-        }
-      while (remain <= NOTE_ALIGN(notelen));
-    }
-
-  head = drv->ni_head;
-  space = drv->ni_bufsize - head;
-  space = space < notelen ? space : notelen;
-  memcpy(drv->ni_buffer + head, note, space);
-  memcpy(drv->ni_buffer, buf + space, notelen - space);
-  drv->ni_head = noteram_next(drv, head, NOTE_ALIGN(notelen));
-  spin_unlock_irqrestore_notrace(&drv->lock, flags);
-  poll_notify(&drv->pfd, 1, POLLIN);
-}
-
 /****************************************************************************
  * Name: noteram_dump_init_context
  ****************************************************************************/
@@ -1374,6 +1814,11 @@ noteram_initialize(FAR const char *devpath, size_t bufsize, bool overwrite)
   drv->ni_tail = 0;
   drv->ni_read = 0;
   drv->pfd = NULL;
+  drv->ni_dropped = 0;
+  drv->ni_overwritten = 0;
+#ifdef CONFIG_DRIVERS_NOTERAM_PERCPU
+  memset(drv->ni_ring, 0, sizeof(drv->ni_ring));
+#endif
 
   ret = note_driver_register(&drv->driver);
   if (ret < 0)
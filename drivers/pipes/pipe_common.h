@@ -154,6 +154,7 @@ extern "C"
 struct file;  /* Forward reference */
 struct inode; /* Forward reference */
 
+void    pipecommon_wakeup(FAR sem_t *sem);
 FAR struct pipe_dev_s *pipecommon_allocdev(size_t bufsize);
 void    pipecommon_freedev(FAR struct pipe_dev_s *dev);
 int     pipecommon_open(FAR struct file *filep);
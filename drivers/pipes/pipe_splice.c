@@ -0,0 +1,866 @@
+/****************************************************************************
+ * drivers/pipes/pipe_splice.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/param.h>
+#include <sys/uio.h>
+#include <fcntl.h>
+#include <errno.h>
+
+#include <nuttx/fs/fs.h>
+#include <nuttx/mutex.h>
+#include <nuttx/semaphore.h>
+
+#include "pipe_common.h"
+
+#ifdef CONFIG_PIPES
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: pipe_splice_dev
+ *
+ * Description:
+ *   Return the pipe behind a file, or NULL if the file is not a pipe.
+ *
+ ****************************************************************************/
+
+static FAR struct pipe_dev_s *pipe_splice_dev(FAR struct file *filep)
+{
+  FAR struct inode *inode = filep->f_inode;
+
+  if (inode == NULL || !INODE_IS_PIPE(inode))
+    {
+      return NULL;
+    }
+
+  return inode->i_private;
+}
+
+/****************************************************************************
+ * Name: pipe_splice_nonblock
+ ****************************************************************************/
+
+static bool pipe_splice_nonblock(FAR struct file *filep, unsigned int flags)
+{
+  return (filep->f_oflags & O_NONBLOCK) != 0 ||
+         (flags & SPLICE_F_NONBLOCK) != 0;
+}
+
+/****************************************************************************
+ * Name: pipe_splice_consumed
+ *
+ * Description:
+ *   Notify the writers and the poll waiters that data was removed from the
+ *   pipe.
+ *
+ ****************************************************************************/
+
+static void pipe_splice_consumed(FAR struct pipe_dev_s *dev)
+{
+  if (circbuf_used(&dev->d_buffer) <= (dev->d_bufsize - dev->d_polloutthrd))
+    {
+      poll_notify(dev->d_fds, CONFIG_DEV_PIPE_NPOLLWAITERS, POLLOUT);
+    }
+
+  pipecommon_wakeup(&dev->d_wrsem);
+}
+
+/****************************************************************************
+ * Name: pipe_splice_produced
+ *
+ * Description:
+ *   Notify the readers and the poll waiters that data was added to the
+ *   pipe.
+ *
+ ****************************************************************************/
+
+static void pipe_splice_produced(FAR struct pipe_dev_s *dev)
+{
+  if (circbuf_used(&dev->d_buffer) > dev->d_pollinthrd)
+    {
+      poll_notify(dev->d_fds, CONFIG_DEV_PIPE_NPOLLWAITERS, POLLIN);
+    }
+
+  pipecommon_wakeup(&dev->d_rdsem);
+}
+
+/****************************************************************************
+ * Name: pipe_splice_waitdata
+ *
+ * Description:
+ *   Wait until the pipe holds some data, as pipecommon_read() does.  This
+ *   is called with d_bflock held.
+ *
+ * Returned Value:
+ *   1 with d_bflock still held if there is data.  Otherwise d_bflock is
+ *   released and zero (end of file) or a negated errno value is returned.
+ *
+ ****************************************************************************/
+
+static int pipe_splice_waitdata(FAR struct pipe_dev_s *dev, bool nonblock)
+{
+  int ret;
+
+  while (circbuf_is_empty(&dev->d_buffer))
+    {
+      if (dev->d_nwriters <= 0 && PIPE_IS_POLICY_0(dev->d_flags))
+        {
+          ret = 0;
+        }
+      else if (nonblock)
+        {
+          ret = -EAGAIN;
+        }
+      else
+        {
+          nxrmutex_unlock(&dev->d_bflock);
+          ret = nxsem_wait(&dev->d_rdsem);
+          if (ret < 0 || (ret = nxrmutex_lock(&dev->d_bflock)) < 0)
+            {
+              return ret;
+            }
+
+          continue;
+        }
+
+      nxrmutex_unlock(&dev->d_bflock);
+      return ret;
+    }
+
+  return 1;
+}
+
+/****************************************************************************
+ * Name: pipe_splice_waitspace
+ *
+ * Description:
+ *   Wait until the pipe has some free space, as pipecommon_write() does.
+ *   This is called with d_bflock held.
+ *
+ * Returned Value:
+ *   1 with d_bflock still held if there is space.  Otherwise d_bflock is
+ *   released and a negated errno value is returned.
+ *
+ ****************************************************************************/
+
+static int pipe_splice_waitspace(FAR struct pipe_dev_s *dev, bool nonblock)
+{
+  int ret;
+
+  for (; ; )
+    {
+      if (dev->d_nreaders <= 0 && PIPE_IS_POLICY_0(dev->d_flags))
+        {
+          ret = -EPIPE;
+        }
+      else if (!circbuf_is_full(&dev->d_buffer))
+        {
+          return 1;
+        }
+      else if (nonblock)
+        {
+          ret = -EAGAIN;
+        }
+      else
+        {
+          nxrmutex_unlock(&dev->d_bflock);
+          ret = nxsem_wait(&dev->d_wrsem);
+          if (ret < 0 || (ret = nxrmutex_lock(&dev->d_bflock)) < 0)
+            {
+              return ret;
+            }
+
+          continue;
+        }
+
+      nxrmutex_unlock(&dev->d_bflock);
+      return ret;
+    }
+}
+
+/****************************************************************************
+ * Name: pipe_splice_out
+ *
+ * Description:
+ *   Write the data of a pipe to a file straight from the pipe buffer.  The
+ *   pipe stays locked while the file is written, so that the data is
+ *   consumed in order.
+ *
+ ****************************************************************************/
+
+static ssize_t pipe_splice_out(FAR struct pipe_dev_s *dev, bool nonblock,
+                               FAR struct file *outfile, FAR off_t *off_out,
+                               size_t len)
+{
+  FAR void *buf;
+  size_t nwritten = 0;
+  size_t size;
+  ssize_t ret;
+
+  ret = nxrmutex_lock(&dev->d_bflock);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  ret = pipe_splice_waitdata(dev, nonblock);
+  if (ret <= 0)
+    {
+      return ret;
+    }
+
+  while (nwritten < len)
+    {
+      buf = circbuf_get_readptr(&dev->d_buffer, &size);
+      if (size == 0)
+        {
+          break;
+        }
+
+      size = MIN(size, len - nwritten);
+      if (off_out != NULL)
+        {
+          ret = file_pwrite(outfile, buf, size, *off_out + nwritten);
+        }
+      else
+        {
+          ret = file_write(outfile, buf, size);
+        }
+
+      if (ret <= 0)
+        {
+          break;
+        }
+
+      circbuf_readcommit(&dev->d_buffer, ret);
+      nwritten += ret;
+
+      if ((size_t)ret < size)
+        {
+          break;
+        }
+    }
+
+  if (nwritten > 0)
+    {
+      pipe_splice_consumed(dev);
+    }
+
+  nxrmutex_unlock(&dev->d_bflock);
+
+  if (nwritten == 0)
+    {
+      return ret;
+    }
+
+  if (off_out != NULL)
+    {
+      *off_out += nwritten;
+    }
+
+  return nwritten;
+}
+
+/****************************************************************************
+ * Name: pipe_splice_in
+ *
+ * Description:
+ *   Read a file straight into the buffer of a pipe.  The pipe stays locked
+ *   while the file is read, as a write to a pipe is atomic.  Only a regular
+ *   file is read more than once, so that the lock is not held waiting for
+ *   more data from a socket or a device.
+ *
+ ****************************************************************************/
+
+static ssize_t pipe_splice_in(FAR struct file *infile, FAR off_t *off_in,
+                              FAR struct pipe_dev_s *dev, bool nonblock,
+                              size_t len)
+{
+  FAR void *buf;
+  size_t nread = 0;
+  size_t size;
+  ssize_t ret;
+
+  ret = nxrmutex_lock(&dev->d_bflock);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  ret = pipe_splice_waitspace(dev, nonblock);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  while (nread < len)
+    {
+      buf = circbuf_get_writeptr(&dev->d_buffer, &size);
+      if (size == 0)
+        {
+          break;
+        }
+
+      size = MIN(size, len - nread);
+      if (off_in != NULL)
+        {
+          ret = file_pread(infile, buf, size, *off_in + nread);
+        }
+      else
+        {
+          ret = file_read(infile, buf, size);
+        }
+
+      if (ret <= 0)
+        {
+          break;
+        }
+
+      circbuf_writecommit(&dev->d_buffer, ret);
+      nread += ret;
+
+      if ((size_t)ret < size || !INODE_IS_MOUNTPT(infile->f_inode))
+        {
+          break;
+        }
+    }
+
+  if (nread > 0)
+    {
+      pipe_splice_produced(dev);
+    }
+
+  nxrmutex_unlock(&dev->d_bflock);
+
+  if (nread == 0)
+    {
+      return ret;
+    }
+
+  if (off_in != NULL)
+    {
+      *off_in += nread;
+    }
+
+  return nread;
+}
+
+/****************************************************************************
+ * Name: pipe_splice_pipe
+ *
+ * Description:
+ *   Copy data from one pipe buffer to the other, consuming it from the
+ *   input pipe unless peek is set.  Both pipes are locked in the order of
+ *   their addresses and neither is held while waiting.
+ *
+ ****************************************************************************/
+
+static ssize_t pipe_splice_pipe(FAR struct pipe_dev_s *in, bool inblock,
+                                FAR struct pipe_dev_s *out, bool outblock,
+                                size_t len, bool peek)
+{
+  FAR struct pipe_dev_s *first = in < out ? in : out;
+  FAR struct pipe_dev_s *second = in < out ? out : in;
+  FAR void *buf;
+  size_t ncopied = 0;
+  size_t size;
+  int ret;
+
+  for (; ; )
+    {
+      ret = nxrmutex_lock(&first->d_bflock);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      ret = nxrmutex_lock(&second->d_bflock);
+      if (ret < 0)
+        {
+          nxrmutex_unlock(&first->d_bflock);
+          return ret;
+        }
+
+      if (circbuf_is_empty(&in->d_buffer))
+        {
+          if (in->d_nwriters <= 0 && PIPE_IS_POLICY_0(in->d_flags))
+            {
+              ret = 0;
+              break;
+            }
+
+          if (!inblock)
+            {
+              ret = -EAGAIN;
+              break;
+            }
+
+          nxrmutex_unlock(&second->d_bflock);
+          nxrmutex_unlock(&first->d_bflock);
+          ret = nxsem_wait(&in->d_rdsem);
+        }
+      else if (out->d_nreaders <= 0 && PIPE_IS_POLICY_0(out->d_flags))
+        {
+          ret = -EPIPE;
+          break;
+        }
+      else if (circbuf_is_full(&out->d_buffer))
+        {
+          if (!outblock)
+            {
+              ret = -EAGAIN;
+              break;
+            }
+
+          nxrmutex_unlock(&second->d_bflock);
+          nxrmutex_unlock(&first->d_bflock);
+          ret = nxsem_wait(&out->d_wrsem);
+        }
+      else
+        {
+          break;
+        }
+
+      if (ret < 0)
+        {
+          return ret;
+        }
+    }
+
+  if (ret < 0 || circbuf_is_empty(&in->d_buffer))
+    {
+      nxrmutex_unlock(&second->d_bflock);
+      nxrmutex_unlock(&first->d_bflock);
+      return ret;
+    }
+
+  len = MIN(len, circbuf_used(&in->d_buffer));
+  len = MIN(len, circbuf_space(&out->d_buffer));
+
+  while (ncopied < len)
+    {
+      buf  = circbuf_get_writeptr(&out->d_buffer, &size);
+      size = MIN(size, len - ncopied);
+
+      if (peek)
+        {
+          circbuf_peekat(&in->d_buffer, in->d_buffer.tail + ncopied,
+                         buf, size);
+        }
+      else
+        {
+          circbuf_read(&in->d_buffer, buf, size);
+        }
+
+      circbuf_writecommit(&out->d_buffer, size);
+      ncopied += size;
+    }
+
+  if (!peek)
+    {
+      pipe_splice_consumed(in);
+    }
+
+  pipe_splice_produced(out);
+
+  nxrmutex_unlock(&second->d_bflock);
+  nxrmutex_unlock(&first->d_bflock);
+  return ncopied;
+}
+
+/****************************************************************************
+ * Name: pipe_vmsplice_write
+ *
+ * Description:
+ *   Copy the user buffers into a pipe.  Like a write, this waits until all
+ *   of them are in the pipe unless nonblock is set.
+ *
+ ****************************************************************************/
+
+static ssize_t pipe_vmsplice_write(FAR struct pipe_dev_s *dev, bool nonblock,
+                                   FAR const struct iovec *iov,
+                                   size_t nr_segs)
+{
+  FAR const uint8_t *base;
+  size_t nwritten = 0;
+  size_t remaining;
+  int ret;
+
+  ret = nxrmutex_lock(&dev->d_bflock);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  for (; nr_segs > 0; nr_segs--, iov++)
+    {
+      base      = iov->iov_base;
+      remaining = iov->iov_len;
+
+      while (remaining > 0)
+        {
+          ret = pipe_splice_waitspace(dev, nonblock);
+          if (ret < 0)
+            {
+              return nwritten > 0 ? nwritten : ret;
+            }
+
+          ret = circbuf_write(&dev->d_buffer, base, remaining);
+          pipe_splice_produced(dev);
+
+          base      += ret;
+          remaining -= ret;
+          nwritten  += ret;
+        }
+    }
+
+  nxrmutex_unlock(&dev->d_bflock);
+  return nwritten;
+}
+
+/****************************************************************************
+ * Name: pipe_vmsplice_read
+ *
+ * Description:
+ *   Copy the data of a pipe to the user buffers.  Like a read, this waits
+ *   for data but returns whatever is available.
+ *
+ ****************************************************************************/
+
+static ssize_t pipe_vmsplice_read(FAR struct pipe_dev_s *dev, bool nonblock,
+                                  FAR const struct iovec *iov,
+                                  size_t nr_segs)
+{
+  size_t nread = 0;
+  int ret;
+
+  ret = nxrmutex_lock(&dev->d_bflock);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  ret = pipe_splice_waitdata(dev, nonblock);
+  if (ret <= 0)
+    {
+      return ret;
+    }
+
+  for (; nr_segs > 0 && !circbuf_is_empty(&dev->d_buffer);
+       nr_segs--, iov++)
+    {
+      nread += circbuf_read(&dev->d_buffer, iov->iov_base, iov->iov_len);
+    }
+
+  pipe_splice_consumed(dev);
+  nxrmutex_unlock(&dev->d_bflock);
+  return nread;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: file_splice
+ *
+ * Description:
+ *   Equivalent to the standard splice() function except that is accepts
+ *   struct file instances instead of file descriptors and it does not set
+ *   the errno variable.
+ *
+ ****************************************************************************/
+
+ssize_t file_splice(FAR struct file *infile, FAR off_t *off_in,
+                    FAR struct file *outfile, FAR off_t *off_out,
+                    size_t len, unsigned int flags)
+{
+  FAR struct pipe_dev_s *in = pipe_splice_dev(infile);
+  FAR struct pipe_dev_s *out = pipe_splice_dev(outfile);
+
+  if ((in == NULL && out == NULL) || (in != NULL && in == out))
+    {
+      return -EINVAL;
+    }
+
+  if ((in != NULL && off_in != NULL) || (out != NULL && off_out != NULL))
+    {
+      return -ESPIPE;
+    }
+
+  if ((off_in != NULL && *off_in < 0) || (off_out != NULL && *off_out < 0))
+    {
+      return -EINVAL;
+    }
+
+  if ((in != NULL && (infile->f_oflags & O_RDOK) == 0) ||
+      (out != NULL && (outfile->f_oflags & O_WROK) == 0))
+    {
+      return -EBADF;
+    }
+
+  if (len == 0)
+    {
+      return 0;
+    }
+
+  if (in != NULL && out != NULL)
+    {
+      return pipe_splice_pipe(in, !pipe_splice_nonblock(infile, flags),
+                              out, !pipe_splice_nonblock(outfile, flags),
+                              len, false);
+    }
+  else if (in != NULL)
+    {
+      return pipe_splice_out(in, pipe_splice_nonblock(infile, flags),
+                             outfile, off_out, len);
+    }
+  else
+    {
+      return pipe_splice_in(infile, off_in, out,
+                            pipe_splice_nonblock(outfile, flags), len);
+    }
+}
+
+/****************************************************************************
+ * Name: file_tee
+ *
+ * Description:
+ *   Equivalent to the standard tee() function except that is accepts
+ *   struct file instances instead of file descriptors and it does not set
+ *   the errno variable.
+ *
+ ****************************************************************************/
+
+ssize_t file_tee(FAR struct file *infile, FAR struct file *outfile,
+                 size_t len, unsigned int flags)
+{
+  FAR struct pipe_dev_s *in = pipe_splice_dev(infile);
+  FAR struct pipe_dev_s *out = pipe_splice_dev(outfile);
+
+  if (in == NULL || out == NULL || in == out)
+    {
+      return -EINVAL;
+    }
+
+  if ((infile->f_oflags & O_RDOK) == 0 || (outfile->f_oflags & O_WROK) == 0)
+    {
+      return -EBADF;
+    }
+
+  if (len == 0)
+    {
+      return 0;
+    }
+
+  return pipe_splice_pipe(in, !pipe_splice_nonblock(infile, flags),
+                          out, !pipe_splice_nonblock(outfile, flags),
+                          len, true);
+}
+
+/****************************************************************************
+ * Name: splice
+ *
+ * Description:
+ *   splice() moves data between two file descriptors, at least one of
+ *   which refers to a pipe, without copying it through user memory.  The
+ *   data is copied once, straight between the pipe buffer and the other
+ *   file.
+ *
+ * Input Parameters:
+ *   fd_in   - The file descriptor to read from
+ *   off_in  - NULL to read from the current position of a file that is not
+ *             a pipe, or the offset to read from.  The offset is updated
+ *             and the file position is not changed.
+ *   fd_out  - The file descriptor to write to
+ *   off_out - The same as off_in, for fd_out
+ *   len     - The maximum number of bytes to move
+ *   flags   - SPLICE_F_NONBLOCK not to wait on the pipes.  The other
+ *             SPLICE_F_* flags are accepted and ignored.
+ *
+ * Returned Value:
+ *   The number of bytes moved, zero at the end of the input, or -1 (ERROR)
+ *   with the errno value set appropriately.
+ *
+ ****************************************************************************/
+
+ssize_t splice(int fd_in, FAR off_t *off_in, int fd_out,
+               FAR off_t *off_out, size_t len, unsigned int flags)
+{
+  FAR struct file *infile;
+  FAR struct file *outfile;
+  ssize_t ret;
+
+  ret = fs_getfilep(fd_in, &infile);
+  if (ret < 0)
+    {
+      goto errout;
+    }
+
+  ret = fs_getfilep(fd_out, &outfile);
+  if (ret < 0)
+    {
+      fs_putfilep(infile);
+      goto errout;
+    }
+
+  ret = file_splice(infile, off_in, outfile, off_out, len, flags);
+  fs_putfilep(outfile);
+  fs_putfilep(infile);
+  if (ret < 0)
+    {
+      goto errout;
+    }
+
+  return ret;
+
+errout:
+  set_errno(-ret);
+  return ERROR;
+}
+
+/****************************************************************************
+ * Name: tee
+ *
+ * Description:
+ *   tee() copies data from one pipe to another without consuming it, so
+ *   that it can still be spliced or read from the input pipe.
+ *
+ * Input Parameters:
+ *   fd_in  - The pipe to copy from
+ *   fd_out - The pipe to copy to
+ *   len    - The maximum number of bytes to copy
+ *   flags  - The same as for splice()
+ *
+ * Returned Value:
+ *   The number of bytes copied, zero if the input pipe is empty and has no
+ *   writers, or -1 (ERROR) with the errno value set appropriately.
+ *
+ ****************************************************************************/
+
+ssize_t tee(int fd_in, int fd_out, size_t len, unsigned int flags)
+{
+  FAR struct file *infile;
+  FAR struct file *outfile;
+  ssize_t ret;
+
+  ret = fs_getfilep(fd_in, &infile);
+  if (ret < 0)
+    {
+      goto errout;
+    }
+
+  ret = fs_getfilep(fd_out, &outfile);
+  if (ret < 0)
+    {
+      fs_putfilep(infile);
+      goto errout;
+    }
+
+  ret = file_tee(infile, outfile, len, flags);
+  fs_putfilep(outfile);
+  fs_putfilep(infile);
+  if (ret < 0)
+    {
+      goto errout;
+    }
+
+  return ret;
+
+errout:
+  set_errno(-ret);
+  return ERROR;
+}
+
+/****************************************************************************
+ * Name: vmsplice
+ *
+ * Description:
+ *   vmsplice() copies user buffers into a pipe opened for writing, or the
+ *   data of a pipe opened for reading to user buffers.  There is no virtual
+ *   memory to map the buffers into the pipe, so they are always copied and
+ *   SPLICE_F_GIFT is ignored.
+ *
+ * Input Parameters:
+ *   fd      - The pipe
+ *   iov     - The user buffers
+ *   nr_segs - The number of entries in iov
+ *   flags   - The same as for splice()
+ *
+ * Returned Value:
+ *   The number of bytes copied, or -1 (ERROR) with the errno value set
+ *   appropriately.
+ *
+ ****************************************************************************/
+
+ssize_t vmsplice(int fd, FAR const struct iovec *iov, size_t nr_segs,
+                 unsigned int flags)
+{
+  FAR struct pipe_dev_s *dev;
+  FAR struct file *filep;
+  ssize_t ret;
+
+  ret = fs_getfilep(fd, &filep);
+  if (ret < 0)
+    {
+      goto errout;
+    }
+
+  dev = pipe_splice_dev(filep);
+  if (dev == NULL)
+    {
+      ret = -EBADF;
+    }
+  else if ((filep->f_oflags & O_WROK) != 0)
+    {
+      ret = pipe_vmsplice_write(dev, pipe_splice_nonblock(filep, flags),
+                                iov, nr_segs);
+    }
+  else
+    {
+      ret = pipe_vmsplice_read(dev, pipe_splice_nonblock(filep, flags),
+                               iov, nr_segs);
+    }
+
+  fs_putfilep(filep);
+  if (ret < 0)
+    {
+      goto errout;
+    }
+
+  return ret;
+
+errout:
+  set_errno(-ret);
+  return ERROR;
+}
+
+#endif /* CONFIG_PIPES */
@@ -229,6 +229,45 @@ void syslog_add_intbuffer(FAR const char *buffer, size_t buflen);
 void syslog_flush_intbuffer(bool force);
 #endif
 
+/****************************************************************************
+ * Name: syslog_async_write
+ *
+ * Description:
+ *   Queue the buffer for the low priority work queue to write it to the
+ *   channels.
+ *
+ * Input Parameters:
+ *   buffer - The buffer containing the data to be output
+ *   buflen - The number of bytes in the buffer
+ *
+ * Returned Value:
+ *   true if the buffer was queued, or dropped because the queue is full.
+ *   false if it must be written synchronously.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SYSLOG_ASYNC
+bool syslog_async_write(FAR const char *buffer, size_t buflen);
+#endif
+
+/****************************************************************************
+ * Name: syslog_async_flush
+ *
+ * Description:
+ *   Write the queued buffers to the channels from the caller context.
+ *
+ * Input Parameters:
+ *   force   - Use the force() method of the channel vs. the putc() method.
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SYSLOG_ASYNC
+void syslog_async_flush(bool force);
+#endif
+
 /****************************************************************************
  * Name: syslog_write_foreach
  *
@@ -0,0 +1,396 @@
+/****************************************************************************
+ * drivers/syslog/syslog_async.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <assert.h>
+
+#include <nuttx/arch.h>
+#include <nuttx/atomic.h>
+#include <nuttx/init.h>
+#include <nuttx/irq.h>
+#include <nuttx/sched.h>
+#include <nuttx/spinlock.h>
+#include <nuttx/syslog/syslog.h>
+#include <nuttx/wqueue.h>
+
+#include "syslog.h"
+
+#ifdef CONFIG_SYSLOG_ASYNC
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_SMP
+#  define SYSLOG_ASYNC_NRINGS   CONFIG_SMP_NCPUS
+#else
+#  define SYSLOG_ASYNC_NRINGS   1
+#endif
+
+#define SYSLOG_ASYNC_MASK       (CONFIG_SYSLOG_ASYNC_BUFSIZE - 1)
+#define SYSLOG_ASYNC_HDRSIZE    sizeof(struct syslog_async_hdr_s)
+
+/* A longer write is split into several records */
+
+#define SYSLOG_ASYNC_MAXRECORD  (CONFIG_SYSLOG_ASYNC_BUFSIZE / 4)
+
+/* The size of the batches handed to the channels */
+
+#define SYSLOG_ASYNC_BATCH      128
+
+static_assert((CONFIG_SYSLOG_ASYNC_BUFSIZE & SYSLOG_ASYNC_MASK) == 0,
+              "CONFIG_SYSLOG_ASYNC_BUFSIZE must be a power of two");
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* Each record in a ring is a header followed by the text, both wrapping
+ * around the end of the buffer.  The sequence number orders the records
+ * of all the rings.
+ */
+
+struct syslog_async_hdr_s
+{
+  uint32_t sh_seq;                 /* Global sequence number */
+  uint32_t sh_len;                 /* Length of the text */
+};
+
+/* The ring of one CPU.  Only that CPU adds records, with its interrupts
+ * disabled, and only the drain removes them, so neither side takes a
+ * lock.  The indexes are free-running.
+ */
+
+struct syslog_async_ring_s
+{
+  volatile uint32_t sr_head;       /* Written by the owning CPU */
+  volatile uint32_t sr_tail;       /* Written by the drain */
+  uint8_t sr_buffer[CONFIG_SYSLOG_ASYNC_BUFSIZE];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct syslog_async_ring_s g_syslog_async_ring[SYSLOG_ASYNC_NRINGS];
+static struct work_s g_syslog_async_work;
+static atomic_t g_syslog_async_seq;
+static uint32_t g_syslog_async_next;  /* Next record to write, drain only */
+static atomic_t g_syslog_async_dropped;
+static atomic_t g_syslog_async_draining;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: syslog_async_copyin
+ ****************************************************************************/
+
+static void syslog_async_copyin(FAR struct syslog_async_ring_s *ring,
+                                uint32_t index, FAR const void *data,
+                                size_t len)
+{
+  FAR const uint8_t *src = data;
+
+  while (len-- > 0)
+    {
+      ring->sr_buffer[index++ & SYSLOG_ASYNC_MASK] = *src++;
+    }
+}
+
+/****************************************************************************
+ * Name: syslog_async_copyout
+ ****************************************************************************/
+
+static void syslog_async_copyout(FAR struct syslog_async_ring_s *ring,
+                                 uint32_t index, FAR void *data,
+                                 size_t len)
+{
+  FAR uint8_t *dest = data;
+
+  while (len-- > 0)
+    {
+      *dest++ = ring->sr_buffer[index++ & SYSLOG_ASYNC_MASK];
+    }
+}
+
+/****************************************************************************
+ * Name: syslog_async_oldest
+ *
+ * Description:
+ *   Return the ring holding the oldest record, or NULL if all are empty.
+ *
+ ****************************************************************************/
+
+static FAR struct syslog_async_ring_s *
+syslog_async_oldest(FAR struct syslog_async_hdr_s *hdr)
+{
+  FAR struct syslog_async_ring_s *oldest = NULL;
+  struct syslog_async_hdr_s tmp;
+  int i;
+
+  for (i = 0; i < SYSLOG_ASYNC_NRINGS; i++)
+    {
+      FAR struct syslog_async_ring_s *ring = &g_syslog_async_ring[i];
+
+      if (ring->sr_head == ring->sr_tail)
+        {
+          continue;
+        }
+
+      /* Read the record only after having seen the head */
+
+      UP_DMB();
+      syslog_async_copyout(ring, ring->sr_tail, &tmp, sizeof(tmp));
+      if (oldest == NULL || (int32_t)(tmp.sh_seq - hdr->sh_seq) < 0)
+        {
+          oldest = ring;
+          *hdr   = tmp;
+        }
+    }
+
+  return oldest;
+}
+
+/****************************************************************************
+ * Name: syslog_async_drain
+ *
+ * Description:
+ *   Write the records of all the rings to the channels in the order of
+ *   their sequence numbers, several records per write.  The drain stops at
+ *   a record whose predecessor has a sequence number but is not in its ring
+ *   yet, because another CPU is still adding it; the worker retries later.
+ *   After a panic, the records are written as they are found.  A record
+ *   that lands after a forced drain has skipped past it is written at
+ *   once, and the next expected sequence number never moves backwards.
+ *
+ ****************************************************************************/
+
+static void syslog_async_drain(bool force)
+{
+  FAR struct syslog_async_ring_s *ring;
+  struct syslog_async_hdr_s hdr;
+  char batch[SYSLOG_ASYNC_BATCH];
+  size_t nbatch = 0;
+  uint32_t index;
+  uint32_t chunk;
+  int dropped;
+
+  while ((ring = syslog_async_oldest(&hdr)) != NULL)
+    {
+      if ((int32_t)(hdr.sh_seq - g_syslog_async_next) > 0 && !force)
+        {
+          break;
+        }
+
+      if ((int32_t)(hdr.sh_seq + 1 - g_syslog_async_next) > 0)
+        {
+          g_syslog_async_next = hdr.sh_seq + 1;
+        }
+
+      index = ring->sr_tail + SYSLOG_ASYNC_HDRSIZE;
+      while (hdr.sh_len > 0)
+        {
+          chunk = sizeof(batch) - nbatch;
+          if (chunk > hdr.sh_len)
+            {
+              chunk = hdr.sh_len;
+            }
+
+          syslog_async_copyout(ring, index, batch + nbatch, chunk);
+          index      += chunk;
+          nbatch     += chunk;
+          hdr.sh_len -= chunk;
+
+          if (nbatch == sizeof(batch))
+            {
+              syslog_write_foreach(batch, nbatch, force);
+              nbatch = 0;
+            }
+        }
+
+      /* Free the record only after having read it */
+
+      UP_DMB();
+      ring->sr_tail = index;
+    }
+
+  if (nbatch > 0)
+    {
+      syslog_write_foreach(batch, nbatch, force);
+    }
+
+  dropped = atomic_xchg(&g_syslog_async_dropped, 0);
+  if (dropped > 0)
+    {
+      nbatch = snprintf(batch, sizeof(batch),
+                        "[%d syslog records dropped]\n", dropped);
+      syslog_write_foreach(batch, nbatch, force);
+    }
+}
+
+/****************************************************************************
+ * Name: syslog_async_worker
+ ****************************************************************************/
+
+static void syslog_async_worker(FAR void *arg)
+{
+  int i;
+
+  if (atomic_xchg(&g_syslog_async_draining, 1) == 0)
+    {
+      syslog_async_drain(false);
+      atomic_set(&g_syslog_async_draining, 0);
+    }
+
+  /* Records added while another drain was finishing, or held back for an
+   * earlier record still being added, are not left for the next write.
+   */
+
+  for (i = 0; i < SYSLOG_ASYNC_NRINGS; i++)
+    {
+      FAR struct syslog_async_ring_s *ring = &g_syslog_async_ring[i];
+
+      if (ring->sr_head != ring->sr_tail)
+        {
+          if (work_available(&g_syslog_async_work))
+            {
+              work_queue(LPWORK, &g_syslog_async_work, syslog_async_worker,
+                         NULL, 1);
+            }
+
+          break;
+        }
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: syslog_async_write
+ *
+ * Description:
+ *   Add the buffer to the ring of this CPU and let the low priority work
+ *   queue write it to the channels.  The buffer is dropped, and counted,
+ *   if the ring is full.  This may be called from any context.
+ *
+ * Input Parameters:
+ *   buffer - The buffer containing the data to be output
+ *   buflen - The number of bytes in the buffer
+ *
+ * Returned Value:
+ *   false if the buffer must be written synchronously instead: early in
+ *   the boot, before the work queues run, or after a panic.
+ *
+ ****************************************************************************/
+
+bool syslog_async_write(FAR const char *buffer, size_t buflen)
+{
+  FAR struct syslog_async_ring_s *ring;
+  struct syslog_async_hdr_s hdr;
+  irqstate_t flags;
+  uint32_t head;
+
+  if (g_nx_initstate != OSINIT_IDLELOOP)
+    {
+      return false;
+    }
+
+  flags = up_irq_save();
+  ring  = &g_syslog_async_ring[this_cpu()];
+  head  = ring->sr_head;
+
+  while (buflen > 0)
+    {
+      hdr.sh_len = buflen < SYSLOG_ASYNC_MAXRECORD ?
+                   buflen : SYSLOG_ASYNC_MAXRECORD;
+
+      if (CONFIG_SYSLOG_ASYNC_BUFSIZE - (head - ring->sr_tail) <
+          SYSLOG_ASYNC_HDRSIZE + hdr.sh_len)
+        {
+          atomic_fetch_add(&g_syslog_async_dropped, 1);
+          break;
+        }
+
+      hdr.sh_seq = atomic_fetch_add(&g_syslog_async_seq, 1);
+      syslog_async_copyin(ring, head, &hdr, SYSLOG_ASYNC_HDRSIZE);
+      syslog_async_copyin(ring, head + SYSLOG_ASYNC_HDRSIZE, buffer,
+                          hdr.sh_len);
+
+      head   += SYSLOG_ASYNC_HDRSIZE + hdr.sh_len;
+      buffer += hdr.sh_len;
+      buflen -= hdr.sh_len;
+    }
+
+  /* Publish the records only after they are complete */
+
+  UP_DMB();
+  ring->sr_head = head;
+  up_irq_restore(flags);
+
+  if (work_available(&g_syslog_async_work))
+    {
+      work_queue(LPWORK, &g_syslog_async_work, syslog_async_worker,
+                 NULL, 0);
+    }
+
+  return true;
+}
+
+/****************************************************************************
+ * Name: syslog_async_flush
+ *
+ * Description:
+ *   Write the pending records to the channels from the caller context.
+ *   After a panic this does not wait for a drain in progress.
+ *
+ * Input Parameters:
+ *   force - Use the force() method of the channels.
+ *
+ ****************************************************************************/
+
+void syslog_async_flush(bool force)
+{
+  if (atomic_xchg(&g_syslog_async_draining, 1) == 0)
+    {
+      syslog_async_drain(force);
+      atomic_set(&g_syslog_async_draining, 0);
+    }
+  else if (g_nx_initstate == OSINIT_PANIC)
+    {
+      syslog_async_drain(force);
+    }
+}
+
+#endif /* CONFIG_SYSLOG_ASYNC */
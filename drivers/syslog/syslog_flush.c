@@ -68,6 +68,12 @@ int syslog_flush(void)
 {
   int i;
 
+#ifdef CONFIG_SYSLOG_ASYNC
+  /* Write the messages queued for the work queue */
+
+  syslog_async_flush(true);
+#endif
+
 #ifdef CONFIG_SYSLOG_INTBUFFER
   /* Flush any characters that may have been added to the interrupt
    * buffer.
@@ -230,6 +230,13 @@ ssize_t syslog_write(FAR const char *buffer, size_t buflen)
 {
   bool force = !syslog_safe_to_block();
 
+#ifdef CONFIG_SYSLOG_ASYNC
+  if (syslog_async_write(buffer, buflen))
+    {
+      return buflen;
+    }
+#endif
+
 #ifdef CONFIG_SYSLOG_INTBUFFER
   if (force)
     {
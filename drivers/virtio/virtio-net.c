@@ -154,6 +154,10 @@ static int virtio_net_ifdown(FAR struct netdev_lowerhalf_s *dev);
 static int virtio_net_send(FAR struct netdev_lowerhalf_s *dev,
                            FAR netpkt_t *pkt);
 static netpkt_t *virtio_net_recv(FAR struct netdev_lowerhalf_s *dev);
+static int virtio_net_send_batch(FAR struct netdev_lowerhalf_s *dev,
+                                 FAR netpkt_t **pkts, int npkts);
+static int virtio_net_recv_batch(FAR struct netdev_lowerhalf_s *dev,
+                                 FAR netpkt_t **pkts, int npkts);
 #ifdef CONFIG_NET_MCASTGROUP
 static int virtio_net_addmac(FAR struct netdev_lowerhalf_s *dev,
                              FAR const uint8_t *mac);
@@ -194,7 +198,9 @@ static const struct netdev_ops_s g_virtio_net_ops =
 #ifdef CONFIG_NETDEV_IOCTL
   virtio_net_ioctl,
 #endif
-  virtio_net_txfree
+  virtio_net_txfree,
+  virtio_net_send_batch,
+  virtio_net_recv_batch
 };
 
 #ifdef CONFIG_DRIVERS_WIFI_SIM
@@ -415,26 +421,38 @@ static int virtio_net_ifdown(FAR struct netdev_lowerhalf_s *dev)
 }
 
 /****************************************************************************
- * Name: virtio_net_send
+ * Name: virtio_net_send_batch
  ****************************************************************************/
 
-static int virtio_net_send(FAR struct netdev_lowerhalf_s *dev,
-                           FAR netpkt_t *pkt)
+static int virtio_net_send_batch(FAR struct netdev_lowerhalf_s *dev,
+                                 FAR netpkt_t **pkts, int npkts)
 {
   FAR struct virtio_net_priv_s *priv = (FAR struct virtio_net_priv_s *)dev;
   FAR struct virtqueue *vq = priv->vdev->vrings_info[VIRTIO_NET_TX].vq;
+  int i;
+
+  for (i = 0; i < npkts; i++)
+    {
+      /* Check the send length */
 
-  /* Check the send length */
+      if (netpkt_getdatalen(dev, pkts[i]) > VIRTIO_NET_BUFSIZE)
+        {
+          vrterr("net send buffer too large\n");
+          break;
+        }
+
+      /* Add buffer to vq */
+
+      virtio_net_addbuffer(dev, vq, pkts[i], VIRTIO_NET_TX);
+    }
 
-  if (netpkt_getdatalen(dev, pkt) > VIRTIO_NET_BUFSIZE)
+  if (i == 0)
     {
-      vrterr("net send buffer too large\n");
       return -EINVAL;
     }
 
-  /* Add buffer to vq and notify the other side */
+  /* Notify the other side once for all the buffers */
 
-  virtio_net_addbuffer(dev, vq, pkt, VIRTIO_NET_TX);
   virtqueue_kick_lock(vq, &priv->lock[VIRTIO_NET_TX]);
 
   /* Try return Netpkt TX buffer to upper-half. */
@@ -448,49 +466,77 @@ static int virtio_net_send(FAR struct netdev_lowerhalf_s *dev,
       virtqueue_enable_cb_lock(vq, &priv->lock[VIRTIO_NET_TX]);
     }
 
-  return OK;
+  return i;
 }
 
 /****************************************************************************
- * Name: virtio_net_recv
+ * Name: virtio_net_send
  ****************************************************************************/
 
-static netpkt_t *virtio_net_recv(FAR struct netdev_lowerhalf_s *dev)
+static int virtio_net_send(FAR struct netdev_lowerhalf_s *dev,
+                           FAR netpkt_t *pkt)
+{
+  int ret = virtio_net_send_batch(dev, &pkt, 1);
+
+  return ret < 0 ? ret : OK;
+}
+
+/****************************************************************************
+ * Name: virtio_net_recv_batch
+ ****************************************************************************/
+
+static int virtio_net_recv_batch(FAR struct netdev_lowerhalf_s *dev,
+                                 FAR netpkt_t **pkts, int npkts)
 {
   FAR struct virtio_net_priv_s *priv = (FAR struct virtio_net_priv_s *)dev;
   FAR struct virtqueue *vq = priv->vdev->vrings_info[VIRTIO_NET_RX].vq;
   FAR struct virtio_net_llhdr_s *hdr;
   irqstate_t flags;
   uint32_t len;
+  int n;
 
-  /* Fill the free Netpkt RX buffer to the RX virtqueue */
+  /* Fill the free Netpkt RX buffer to the RX virtqueue, once per burst */
 
   virtio_net_rxfill(dev);
 
-  /* Get received buffer form RX virtqueue */
-
-  flags = spin_lock_irqsave(&priv->lock[VIRTIO_NET_RX]);
-  hdr = virtqueue_get_buffer(vq, &len, NULL);
-  if (hdr == NULL)
+  for (n = 0; n < npkts; n++)
     {
-      /* If we have no buffer left, enable RX callback. */
+      /* Get received buffer form RX virtqueue */
 
-      virtqueue_enable_cb(vq);
-      spin_unlock_irqrestore(&priv->lock[VIRTIO_NET_RX], flags);
+      flags = spin_lock_irqsave(&priv->lock[VIRTIO_NET_RX]);
+      hdr = virtqueue_get_buffer(vq, &len, NULL);
+      if (hdr == NULL)
+        {
+          /* If we have no buffer left, enable RX callback. */
+
+          virtqueue_enable_cb(vq);
+          spin_unlock_irqrestore(&priv->lock[VIRTIO_NET_RX], flags);
+
+          vrtinfo("get NULL buffer\n");
+          break;
+        }
 
-      vrtinfo("get NULL buffer\n");
-      return NULL;
-    }
-  else
-    {
       spin_unlock_irqrestore(&priv->lock[VIRTIO_NET_RX], flags);
+
+      /* Set the received pkt length */
+
+      netpkt_setdatalen(dev, hdr->pkt, len - VIRTIO_NET_HDRSIZE);
+      vrtinfo("Recv, hdr=%p, pkt=%p, len=%" PRIu32 "\n", hdr, hdr->pkt, len);
+      pkts[n] = hdr->pkt;
     }
 
-  /* Set the received pkt length */
+  return n;
+}
+
+/****************************************************************************
+ * Name: virtio_net_recv
+ ****************************************************************************/
+
+static netpkt_t *virtio_net_recv(FAR struct netdev_lowerhalf_s *dev)
+{
+  FAR netpkt_t *pkt;
 
-  netpkt_setdatalen(dev, hdr->pkt, len - VIRTIO_NET_HDRSIZE);
-  vrtinfo("Recv, hdr=%p, pkt=%p, len=%" PRIu32 "\n", hdr, hdr->pkt, len);
-  return hdr->pkt;
+  return virtio_net_recv_batch(dev, &pkt, 1) > 0 ? pkt : NULL;
 }
 
 #ifdef CONFIG_NET_MCASTGROUP
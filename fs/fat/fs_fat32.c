@@ -553,6 +553,66 @@ out:
   return ret;
 }
 
+#if CONFIG_FAT_CLUSTER_CACHE > 0
+/****************************************************************************
+ * Name: fat_findcluster
+ *
+ * Description:
+ *   Find the remembered position of the cluster chain of the file that is
+ *   the closest to, but not after, the cluster index.
+ *
+ * Returned Value:
+ *   The index of the position found with its cluster number in 'cluster',
+ *   or zero if there is none.
+ *
+ ****************************************************************************/
+
+static uint32_t fat_findcluster(FAR struct fat_file_s *ff, uint32_t index,
+                                uint32_t nclusters, FAR int *cluster)
+{
+  FAR struct fat_clusterpos_s *pos;
+  uint32_t found = 0;
+  int i;
+
+  for (i = 0; i < CONFIG_FAT_CLUSTER_CACHE; i++)
+    {
+      pos = &ff->ff_clusters[i];
+      if (pos->cp_index > found && pos->cp_index <= index &&
+          pos->cp_index < nclusters)
+        {
+          found    = pos->cp_index;
+          *cluster = pos->cp_cluster;
+        }
+    }
+
+  return found;
+}
+
+/****************************************************************************
+ * Name: fat_savecluster
+ *
+ * Description:
+ *   Remember the cluster number at some index of the cluster chain of the
+ *   file.  Only every n-th cluster is kept, n growing with the size of the
+ *   file so that the positions spread over the whole chain.
+ *
+ ****************************************************************************/
+
+static void fat_savecluster(FAR struct fat_file_s *ff, uint32_t index,
+                            int cluster, uint32_t nclusters)
+{
+  FAR struct fat_clusterpos_s *pos;
+  uint32_t stride = nclusters / CONFIG_FAT_CLUSTER_CACHE + 1;
+
+  if (index % stride == 0)
+    {
+      pos = &ff->ff_clusters[(index / stride) % CONFIG_FAT_CLUSTER_CACHE];
+      pos->cp_index   = index;
+      pos->cp_cluster = cluster;
+    }
+}
+#endif
+
 /****************************************************************************
  * Name: fat_get_sectors
  *
@@ -620,6 +680,22 @@ static int fat_get_sectors(FAR struct file *filep, bool read)
       num_traversed = 1;
     }
 
+#if CONFIG_FAT_CLUSTER_CACHE > 0
+  /* Start from a remembered position of the chain if it is closer */
+
+  if (ff->ff_startcluster != 0)
+    {
+      int cached;
+      int index = fat_findcluster(ff, new_num_clu - 1, num_clu, &cached);
+
+      if (index >= num_traversed)
+        {
+          cluster = cached;
+          num_traversed = index + 1;
+        }
+    }
+#endif
+
   /* Traverse the existing chain */
 
   for (i = num_traversed; i < num_clu && i < new_num_clu; i++)
@@ -632,6 +708,10 @@ static int fat_get_sectors(FAR struct file *filep, bool read)
         {
           return -EIO;
         }
+
+#if CONFIG_FAT_CLUSTER_CACHE > 0
+      fat_savecluster(ff, i, cluster, num_clu);
+#endif
     }
 
   if (read)
@@ -1599,6 +1679,9 @@ static int fat_dup(FAR const struct file *oldp, FAR struct file *newp)
   newff->ff_startcluster     = oldff->ff_startcluster;     /* Start cluster of file on media */
   newff->ff_currentsector    = oldff->ff_currentsector;    /* Current sector */
   newff->ff_cachesector      = 0;                          /* Sector in file buffer */
+#if CONFIG_FAT_CLUSTER_CACHE > 0
+  memcpy(newff->ff_clusters, oldff->ff_clusters, sizeof(oldff->ff_clusters));
+#endif
 
   /* Attach the private date to the struct file instance */
 
@@ -1914,6 +1997,12 @@ static int fat_truncate(FAR struct file *filep, off_t length)
       ndx      = (ff->ff_dirindex & DIRSEC_NDXMASK(fs)) * DIR_SIZE;
       direntry = &fs->fs_buffer[ndx];
 
+#if CONFIG_FAT_CLUSTER_CACHE > 0
+      /* The remembered positions of the chain may be removed */
+
+      memset(ff->ff_clusters, 0, sizeof(ff->ff_clusters));
+#endif
+
       /* Handle the simple case where we are shrinking the file to zero
        * length.
        */
@@ -2326,6 +2415,10 @@ static int fat_unbind(FAR void *handle, FAR struct inode **blkdriver,
         }
     }
 
+  /* Write back anything still buffered for the volume */
+
+  fat_fscacheflush(fs);
+
   /* Unmount ... close the block driver */
 
   if (fs->fs_blkdriver)
@@ -2358,6 +2451,14 @@ static int fat_unbind(FAR void *handle, FAR struct inode **blkdriver,
       fat_io_free(fs->fs_buffer, fs->fs_hwsectorsize);
     }
 
+#if CONFIG_FAT_SECTOR_CACHE > 0
+  if (fs->fs_cachebuffer)
+    {
+      fat_io_free(fs->fs_cachebuffer,
+                  CONFIG_FAT_SECTOR_CACHE * fs->fs_hwsectorsize);
+    }
+#endif
+
   nxmutex_destroy(&fs->fs_lock);
   fs_heap_free(fs);
   return OK;
@@ -857,6 +857,32 @@
  * Public Types
  ****************************************************************************/
 
+#if CONFIG_FAT_SECTOR_CACHE > 0
+/* This structure describes one sector retained by the sector cache of a
+ * mountpoint.  The sector in fs_buffer is never held in the cache as well.
+ */
+
+struct fat_sector_s
+{
+  off_t    fc_sector;              /* The sector held in fc_buffer, or -1 */
+  uint32_t fc_age;                 /* Time of last use, for LRU replacement */
+  bool     fc_dirty;               /* true: fc_buffer must be written back */
+  uint8_t *fc_buffer;              /* One sector of the cache memory */
+};
+#endif
+
+#if CONFIG_FAT_CLUSTER_CACHE > 0
+/* This structure remembers the cluster number found at some position of
+ * the cluster chain of a file.
+ */
+
+struct fat_clusterpos_s
+{
+  uint32_t cp_index;               /* Cluster index in the chain, 0: unused */
+  uint32_t cp_cluster;             /* The cluster number at that index */
+};
+#endif
+
 /* This structure represents the overall mountpoint state.  An instance of
  * this structure is retained as inode private data on each mountpoint that
  * is mounted with a fat32 filesystem.
@@ -891,6 +917,11 @@ struct fat_mountpt_s
   uint8_t  fs_fatsecperclus;       /* MBR: Sectors per allocation unit: 2**n, n=0..7 */
   uint8_t *fs_buffer;              /* This is an allocated buffer to hold one
                                     * sector from the device */
+#if CONFIG_FAT_SECTOR_CACHE > 0
+  uint32_t fs_cacheage;            /* Incremented on each use of the cache */
+  uint8_t *fs_cachebuffer;         /* Memory for all of the cached sectors */
+  struct fat_sector_s fs_cache[CONFIG_FAT_SECTOR_CACHE];
+#endif
 };
 
 /* This structure represents on open file under the mountpoint.  An instance
@@ -913,6 +944,9 @@ struct fat_file_s
   off_t    ff_cachesector;         /* Current sector in the file buffer */
   off_t    ff_pos;                 /* Current position in the file */
   uint8_t *ff_buffer;              /* File buffer (for partial sector accesses) */
+#if CONFIG_FAT_CLUSTER_CACHE > 0
+  struct fat_clusterpos_s ff_clusters[CONFIG_FAT_CLUSTER_CACHE];
+#endif
 };
 
 /* This structure holds the sequence of directory entries used by one
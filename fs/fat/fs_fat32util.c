@@ -270,6 +270,139 @@ static int fat_checkbootrecord(struct fat_mountpt_s *fs)
   return OK;
 }
 
+/****************************************************************************
+ * Name: fat_writesector
+ *
+ * Description:
+ *   Write one buffered sector to the device.  A sector that lies in the FAT
+ *   region is written to every copy of the FAT.
+ *
+ ****************************************************************************/
+
+static int fat_writesector(struct fat_mountpt_s *fs, uint8_t *buffer,
+                           off_t sector)
+{
+  int ret;
+  int i;
+
+  ret = fat_hwwrite(fs, buffer, sector, 1);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  /* Does the sector lie in the FAT region? */
+
+  if (sector >= fs->fs_fatbase && sector < fs->fs_fatbase + fs->fs_nfatsects)
+    {
+      /* Yes, then make the change in the FAT copy as well */
+
+      for (i = fs->fs_fatnumfats; i >= 2; i--)
+        {
+          sector += fs->fs_nfatsects;
+          ret = fat_hwwrite(fs, buffer, sector, 1);
+          if (ret < 0)
+            {
+              return ret;
+            }
+        }
+    }
+
+  return OK;
+}
+
+#if CONFIG_FAT_SECTOR_CACHE > 0
+/****************************************************************************
+ * Name: fat_fscachesave
+ *
+ * Description:
+ *   Move the sector in fs_buffer to the sector cache before fs_buffer is
+ *   reused.  The least recently used cached sector is replaced, it is
+ *   written back first if it is dirty.
+ *
+ ****************************************************************************/
+
+static int fat_fscachesave(struct fat_mountpt_s *fs)
+{
+  FAR struct fat_sector_s *victim = NULL;
+  FAR struct fat_sector_s *slot;
+  int ret;
+  int i;
+
+  if (fs->fs_currentsector < 0)
+    {
+      return OK;
+    }
+
+  for (i = 0; i < CONFIG_FAT_SECTOR_CACHE; i++)
+    {
+      slot = &fs->fs_cache[i];
+
+      /* A stale copy of the sector is possible if fs_currentsector was set
+       * directly by the caller: it is superseded by fs_buffer.
+       */
+
+      if (slot->fc_sector == fs->fs_currentsector)
+        {
+          victim = slot;
+          victim->fc_dirty = false;
+          break;
+        }
+
+      if (victim == NULL || (victim->fc_sector >= 0 &&
+          (slot->fc_sector < 0 || slot->fc_age < victim->fc_age)))
+        {
+          victim = slot;
+        }
+    }
+
+  if (victim->fc_dirty)
+    {
+      ret = fat_writesector(fs, victim->fc_buffer, victim->fc_sector);
+      if (ret < 0)
+        {
+          return ret;
+        }
+    }
+
+  memcpy(victim->fc_buffer, fs->fs_buffer, fs->fs_hwsectorsize);
+  victim->fc_sector = fs->fs_currentsector;
+  victim->fc_dirty  = fs->fs_dirty;
+  victim->fc_age    = ++fs->fs_cacheage;
+
+  fs->fs_currentsector = -1;
+  fs->fs_dirty         = false;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: fat_fscacheinval
+ *
+ * Description:
+ *   Discard the cached copies of sectors that are overwritten on the device
+ *   from another buffer.
+ *
+ ****************************************************************************/
+
+static void fat_fscacheinval(struct fat_mountpt_s *fs, uint8_t *buffer,
+                             off_t sector, unsigned int nsectors)
+{
+  FAR struct fat_sector_s *slot;
+  int i;
+
+  for (i = 0; i < CONFIG_FAT_SECTOR_CACHE; i++)
+    {
+      slot = &fs->fs_cache[i];
+      if (slot->fc_buffer != buffer && slot->fc_sector >= sector &&
+          slot->fc_sector < sector + nsectors)
+        {
+          slot->fc_sector = -1;
+          slot->fc_dirty  = false;
+        }
+    }
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -481,6 +614,9 @@ int fat_mount(struct fat_mountpt_s *fs, bool writeable)
   FAR struct inode *inode;
   struct geometry geo;
   int ret;
+#if CONFIG_FAT_SECTOR_CACHE > 0
+  int ndx;
+#endif
 
   /* Assume that the mount is successful */
 
@@ -520,6 +656,26 @@ int fat_mount(struct fat_mountpt_s *fs, bool writeable)
       goto errout;
     }
 
+#if CONFIG_FAT_SECTOR_CACHE > 0
+  /* Allocate the sectors of the sector cache */
+
+  fs->fs_cachebuffer = (FAR uint8_t *)
+    fat_io_alloc(CONFIG_FAT_SECTOR_CACHE * fs->fs_hwsectorsize);
+  if (!fs->fs_cachebuffer)
+    {
+      ret = -ENOMEM;
+      goto errout_with_buffer;
+    }
+
+  for (ndx = 0; ndx < CONFIG_FAT_SECTOR_CACHE; ndx++)
+    {
+      fs->fs_cache[ndx].fc_sector = -1;
+      fs->fs_cache[ndx].fc_dirty  = false;
+      fs->fs_cache[ndx].fc_buffer = fs->fs_cachebuffer +
+                                    ndx * fs->fs_hwsectorsize;
+    }
+#endif
+
   /* Search FAT boot record on the drive.  First check the MBR at sector
    * zero.  This could be either the boot record or a partition that refers
    * to the boot record.
@@ -528,7 +684,8 @@ int fat_mount(struct fat_mountpt_s *fs, bool writeable)
    * a likely failure point.
    */
 
-  fs->fs_fatbase = 0;
+  fs->fs_fatbase       = 0;
+  fs->fs_currentsector = -1;
   ret = fat_hwread(fs, fs->fs_buffer, 0, 1);
   if (ret < 0)
     {
@@ -658,6 +815,15 @@ int fat_mount(struct fat_mountpt_s *fs, bool writeable)
   return OK;
 
 errout_with_buffer:
+#if CONFIG_FAT_SECTOR_CACHE > 0
+  if (fs->fs_cachebuffer)
+    {
+      fat_io_free(fs->fs_cachebuffer,
+                  CONFIG_FAT_SECTOR_CACHE * fs->fs_hwsectorsize);
+      fs->fs_cachebuffer = NULL;
+    }
+
+#endif
   fat_io_free(fs->fs_buffer, fs->fs_hwsectorsize);
   fs->fs_buffer = NULL;
 
@@ -759,6 +925,13 @@ int fat_hwwrite(struct fat_mountpt_s *fs, uint8_t *buffer, off_t sector,
   if (fs && fs->fs_blkdriver)
     {
       struct inode *inode = fs->fs_blkdriver;
+
+#if CONFIG_FAT_SECTOR_CACHE > 0
+      /* Cached copies of the sectors are now out of date */
+
+      fat_fscacheinval(fs, buffer, sector, nsectors);
+#endif
+
       if (inode && inode->u.i_bops && inode->u.i_bops->write)
         {
           ssize_t nsectorswritten =
@@ -1762,13 +1935,18 @@ int fat_dirextend(FAR struct fat_mountpt_s *fs, FAR struct fat_file_s *ff,
  * Name: fat_fscacheflush
  *
  * Description:
- *   Flush any dirty sector if fs_buffer as necessary
+ *   Flush any dirty sector if fs_buffer as necessary, and all of the dirty
+ *   sectors of the sector cache.
  *
  ****************************************************************************/
 
 int fat_fscacheflush(struct fat_mountpt_s *fs)
 {
   int ret;
+#if CONFIG_FAT_SECTOR_CACHE > 0
+  FAR struct fat_sector_s *slot;
+  int i;
+#endif
 
   /* Check if the fs_buffer is dirty.  In this case, we will write back the
    * contents of fs_buffer.
@@ -1778,36 +1956,42 @@ int fat_fscacheflush(struct fat_mountpt_s *fs)
     {
       /* Write the dirty sector */
 
-      ret = fat_hwwrite(fs, fs->fs_buffer, fs->fs_currentsector, 1);
+      ret = fat_writesector(fs, fs->fs_buffer, fs->fs_currentsector);
       if (ret < 0)
         {
           return ret;
         }
 
-      /* Does the sector lie in the FAT region? */
+      /* No longer dirty */
 
-      if (fs->fs_currentsector >= fs->fs_fatbase &&
-          fs->fs_currentsector < fs->fs_fatbase + fs->fs_nfatsects)
-        {
-          int i;
+      fs->fs_dirty = false;
+    }
+
+#if CONFIG_FAT_SECTOR_CACHE > 0
+  /* Then write back the dirty sectors of the cache */
 
-          /* Yes, then make the change in the FAT copy as well */
+  for (i = 0; i < CONFIG_FAT_SECTOR_CACHE; i++)
+    {
+      slot = &fs->fs_cache[i];
+      if (slot->fc_sector >= 0 && slot->fc_sector == fs->fs_currentsector)
+        {
+          /* Stale copy of the sector in fs_buffer */
 
-          for (i = fs->fs_fatnumfats; i >= 2; i--)
+          slot->fc_sector = -1;
+          slot->fc_dirty  = false;
+        }
+      else if (slot->fc_dirty)
+        {
+          ret = fat_writesector(fs, slot->fc_buffer, slot->fc_sector);
+          if (ret < 0)
             {
-              fs->fs_currentsector += fs->fs_nfatsects;
-              ret = fat_hwwrite(fs, fs->fs_buffer, fs->fs_currentsector, 1);
-              if (ret < 0)
-                {
-                  return ret;
-                }
+              return ret;
             }
-        }
-
-      /* No longer dirty */
 
-      fs->fs_dirty = false;
+          slot->fc_dirty = false;
+        }
     }
+#endif
 
   return OK;
 }
@@ -1824,6 +2008,10 @@ int fat_fscacheflush(struct fat_mountpt_s *fs)
 int fat_fscacheread(struct fat_mountpt_s *fs, off_t sector)
 {
   int ret;
+#if CONFIG_FAT_SECTOR_CACHE > 0
+  FAR struct fat_sector_s *slot;
+  int i;
+#endif
 
   /* fs->fs_currentsector holds the current sector that is buffered in
    * fs->fs_buffer. If the requested sector is the same as this sector, then
@@ -1832,6 +2020,31 @@ int fat_fscacheread(struct fat_mountpt_s *fs, off_t sector)
 
   if (fs->fs_currentsector != sector)
     {
+#if CONFIG_FAT_SECTOR_CACHE > 0
+      /* Keep the current sector in the sector cache, dirty or not */
+
+      ret = fat_fscachesave(fs);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      /* Then take the requested sector from the cache if it is there */
+
+      for (i = 0; i < CONFIG_FAT_SECTOR_CACHE; i++)
+        {
+          slot = &fs->fs_cache[i];
+          if (slot->fc_sector == sector)
+            {
+              memcpy(fs->fs_buffer, slot->fc_buffer, fs->fs_hwsectorsize);
+              fs->fs_currentsector = sector;
+              fs->fs_dirty         = slot->fc_dirty;
+              slot->fc_sector      = -1;
+              slot->fc_dirty       = false;
+              return OK;
+            }
+        }
+#else
       /* We will need to read the new sector.  First, flush the cached
        * sector if it is dirty.
        */
@@ -1841,6 +2054,7 @@ int fat_fscacheread(struct fat_mountpt_s *fs, off_t sector)
         {
           return ret;
         }
+#endif
 
       /* Then read the specified sector into the cache */
 
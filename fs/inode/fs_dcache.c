@@ -0,0 +1,244 @@
+/****************************************************************************
+ * fs/inode/fs_dcache.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+#include <nuttx/spinlock.h>
+
+#include "inode/inode.h"
+
+#ifdef CONFIG_FS_DCACHE
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#if (CONFIG_FS_DCACHE_NENTRIES & (CONFIG_FS_DCACHE_NENTRIES - 1)) != 0
+#  error CONFIG_FS_DCACHE_NENTRIES must be a power of two
+#endif
+
+#define DCACHE_MASK (CONFIG_FS_DCACHE_NENTRIES - 1)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One cached lookup result.  The table is direct-mapped: a new entry
+ * simply replaces whatever was cached in its slot.
+ */
+
+struct dcache_entry_s
+{
+  FAR const void *dir;                    /* Directory searched */
+  FAR void       *node;                   /* Object found, NULL: negative */
+  FAR void       *priv;                   /* Private data of the caller */
+  uint32_t        gen;                    /* g_dcache_gen when added */
+  uint8_t         len;                    /* Length of name */
+  char            name[CONFIG_FS_DCACHE_NAMELEN];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct dcache_entry_s g_dcache[CONFIG_FS_DCACHE_NENTRIES];
+
+/* Entries whose generation differs from this one are stale.  It starts at
+ * one so that the zeroed entries are never valid.
+ */
+
+static uint32_t g_dcache_gen = 1;
+static spinlock_t g_dcache_lock = SP_UNLOCKED;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: dcache_slot
+ *
+ * Description:
+ *   Hash the (dir, name) pair into the table (FNV-1a).
+ *
+ ****************************************************************************/
+
+static FAR struct dcache_entry_s *dcache_slot(FAR const void *dir,
+                                              FAR const char *name,
+                                              size_t len)
+{
+  uint32_t hash = 2166136261u ^ (uint32_t)((uintptr_t)dir >> 3);
+
+  while (len-- > 0)
+    {
+      hash = (hash ^ (uint8_t)*name++) * 16777619u;
+    }
+
+  return &g_dcache[(hash ^ (hash >> 16)) & DCACHE_MASK];
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: dcache_lookup
+ *
+ * Description:
+ *   Look up the result of a previous search of name in dir.
+ *
+ * Input Parameters:
+ *   dir  - The directory searched, an opaque key owned by the caller
+ *   name - The name searched, not necessarily NUL terminated
+ *   len  - The length of name
+ *   node - The location to return the object found, NULL for a cached
+ *          negative result
+ *   priv - The location to return the private data of the entry, may be
+ *          NULL
+ *
+ * Returned Value:
+ *   OK if the result is cached, -ENOENT otherwise.
+ *
+ ****************************************************************************/
+
+int dcache_lookup(FAR const void *dir, FAR const char *name, size_t len,
+                  FAR void **node, FAR void **priv)
+{
+  FAR struct dcache_entry_s *entry;
+  irqstate_t flags;
+  int ret = -ENOENT;
+
+  if (len == 0 || len > CONFIG_FS_DCACHE_NAMELEN)
+    {
+      return ret;
+    }
+
+  entry = dcache_slot(dir, name, len);
+  flags = spin_lock_irqsave(&g_dcache_lock);
+
+  if (entry->gen == g_dcache_gen && entry->dir == dir &&
+      entry->len == len && memcmp(entry->name, name, len) == 0)
+    {
+      *node = entry->node;
+      if (priv != NULL)
+        {
+          *priv = entry->priv;
+        }
+
+      ret = OK;
+    }
+
+  spin_unlock_irqrestore(&g_dcache_lock, flags);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: dcache_add
+ *
+ * Description:
+ *   Remember the result of a search of name in dir.  Names longer than
+ *   CONFIG_FS_DCACHE_NAMELEN are not cached.
+ *
+ * Input Parameters:
+ *   dir  - The directory searched
+ *   name - The name searched
+ *   len  - The length of name
+ *   node - The object found, NULL if the name does not exist
+ *   priv - Private data returned by dcache_lookup()
+ *
+ ****************************************************************************/
+
+void dcache_add(FAR const void *dir, FAR const char *name, size_t len,
+                FAR void *node, FAR void *priv)
+{
+  FAR struct dcache_entry_s *entry;
+  irqstate_t flags;
+
+  if (len == 0 || len > CONFIG_FS_DCACHE_NAMELEN)
+    {
+      return;
+    }
+
+  entry = dcache_slot(dir, name, len);
+  flags = spin_lock_irqsave(&g_dcache_lock);
+
+  entry->dir  = dir;
+  entry->node = node;
+  entry->priv = priv;
+  entry->gen  = g_dcache_gen;
+  entry->len  = len;
+  memcpy(entry->name, name, len);
+
+  spin_unlock_irqrestore(&g_dcache_lock, flags);
+}
+
+/****************************************************************************
+ * Name: dcache_invalidate
+ *
+ * Description:
+ *   Forget the cached results of the searches in dir, or every cached
+ *   result if dir is NULL.  This must be called whenever a name is added
+ *   to, removed from or renamed in dir, and before dir is freed.
+ *
+ * Input Parameters:
+ *   dir - The directory that changed, or NULL
+ *
+ ****************************************************************************/
+
+void dcache_invalidate(FAR const void *dir)
+{
+  irqstate_t flags;
+  int i;
+
+  flags = spin_lock_irqsave(&g_dcache_lock);
+
+  if (dir == NULL)
+    {
+      /* Skip zero on wrap around, the zeroed entries must stay stale */
+
+      if (++g_dcache_gen == 0)
+        {
+          g_dcache_gen = 1;
+        }
+    }
+  else
+    {
+      for (i = 0; i < CONFIG_FS_DCACHE_NENTRIES; i++)
+        {
+          if (g_dcache[i].dir == dir)
+            {
+              g_dcache[i].gen = 0;
+            }
+        }
+    }
+
+  spin_unlock_irqrestore(&g_dcache_lock, flags);
+}
+
+#endif /* CONFIG_FS_DCACHE */
@@ -58,10 +58,58 @@
 #include "inode/inode.h"
 #include "fs_heap.h"
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The fl_files array is read without fl_lock.  An array replaced by
+ * files_extend() may still be in use by a reader, so it is only freed by
+ * files_putlist().  Each allocated array has a hidden slot before row 0
+ * linking to the array it replaced.
+ */
+
+#define FILES_RETIRED(files) ((FAR struct file **)*((files) - 1))
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: files_rows and files_array
+ *
+ * Description:
+ *   Read fl_rows and fl_files without fl_lock.  files_extend() stores
+ *   them with release semantics, fl_files first, so a reader that sees a
+ *   row count also sees an array with at least that many rows, and the
+ *   row pointers copied into it.
+ *
+ ****************************************************************************/
+
+static inline_function uint8_t files_rows(FAR struct filelist *list)
+{
+#ifdef __GNUC__
+  return __atomic_load_n(&list->fl_rows, __ATOMIC_ACQUIRE);
+#else
+  uint8_t rows = *(FAR volatile uint8_t *)&list->fl_rows;
+
+  UP_DMB();
+  return rows;
+#endif
+}
+
+static inline_function FAR struct file **
+files_array(FAR struct filelist *list)
+{
+#ifdef __GNUC__
+  return __atomic_load_n(&list->fl_files, __ATOMIC_ACQUIRE);
+#else
+  FAR struct file **files = *(FAR struct file ** volatile *)&list->fl_files;
+
+  UP_DMB();
+  return files;
+#endif
+}
+
 /****************************************************************************
  * Name: files_fget_by_index
  ****************************************************************************/
@@ -70,11 +118,13 @@ static FAR struct file *files_fget_by_index(FAR struct filelist *list,
                                             int l1, int l2, FAR bool *new)
 {
   FAR struct file *filep;
-  irqstate_t flags;
 
-  flags = spin_lock_irqsave_notrace(&list->fl_lock);
-  filep = &list->fl_files[l1][l2];
-  spin_unlock_irqrestore_notrace(&list->fl_lock, flags);
+  /* The caller has checked l1 against files_rows(), so the array read here
+   * has at least that many rows.  The rows themselves are never freed while
+   * the list is in use.
+   */
+
+  filep = &files_array(list)[l1][l2];
 
 #ifdef CONFIG_FS_REFCOUNT
   if (filep->f_inode != NULL)
@@ -122,12 +172,11 @@ static int files_extend(FAR struct filelist *list, size_t row)
 {
   FAR struct file **files;
   uint8_t orig_rows;
-  FAR void *tmp;
   int flags;
   int i;
   int j;
 
-  orig_rows = list->fl_rows;
+  orig_rows = files_rows(list);
   if (row <= orig_rows)
     {
       return 0;
@@ -139,13 +188,17 @@ static int files_extend(FAR struct filelist *list, size_t row)
       return -EMFILE;
     }
 
-  files = fs_heap_malloc(sizeof(FAR struct file *) * row);
+  files = fs_heap_malloc(sizeof(FAR struct file *) * (row + 1));
   DEBUGASSERT(files);
   if (files == NULL)
     {
       return -ENFILE;
     }
 
+  /* Skip the link to the replaced array */
+
+  files++;
+
   i = orig_rows;
   do
     {
@@ -158,7 +211,7 @@ static int files_extend(FAR struct filelist *list, size_t row)
               fs_heap_free(files[i]);
             }
 
-          fs_heap_free(files);
+          fs_heap_free(files - 1);
           return -ENFILE;
         }
     }
@@ -180,7 +233,7 @@ static int files_extend(FAR struct filelist *list, size_t row)
           fs_heap_free(files[j]);
         }
 
-      fs_heap_free(files);
+      fs_heap_free(files - 1);
 
       return OK;
     }
@@ -191,17 +244,23 @@ static int files_extend(FAR struct filelist *list, size_t row)
              list->fl_rows * sizeof(FAR struct file *));
     }
 
-  tmp = list->fl_files;
-  list->fl_files = files;
-  list->fl_rows = row;
+  /* Publish the new array before the new row count, see files_rows().
+   * The replaced array is retired, not freed.
+   */
 
-  spin_unlock_irqrestore_notrace(&list->fl_lock, flags);
+  *(files - 1) = (FAR struct file *)list->fl_files;
 
-  if (tmp != NULL && tmp != &list->fl_prefile)
-    {
-      fs_heap_free(tmp);
-    }
+#ifdef __GNUC__
+  __atomic_store_n(&list->fl_files, files, __ATOMIC_RELEASE);
+  __atomic_store_n(&list->fl_rows, (uint8_t)row, __ATOMIC_RELEASE);
+#else
+  UP_DMB();
+  *(FAR struct file ** volatile *)&list->fl_files = files;
+  UP_DMB();
+  *(FAR volatile uint8_t *)&list->fl_rows = row;
+#endif
 
+  spin_unlock_irqrestore_notrace(&list->fl_lock, flags);
   return OK;
 }
 
@@ -219,7 +278,7 @@ static void task_fssync(FAR struct tcb_s *tcb, FAR void *arg)
       return;
     }
 
-  rows = tcb->group->tg_filelist.fl_rows;
+  rows = files_rows(&tcb->group->tg_filelist);
 
   for (i = 0; i < rows; i++)
     {
@@ -468,6 +527,7 @@ void files_dumplist(FAR struct filelist *list)
 
 void files_putlist(FAR struct filelist *list)
 {
+  FAR struct file **files;
   int i;
   int j;
 
@@ -489,9 +549,15 @@ void files_putlist(FAR struct filelist *list)
         }
     }
 
-  if (list->fl_files != &list->fl_prefile)
+  /* Free the current array and all of the arrays it replaced */
+
+  files = list->fl_files;
+  while (files != NULL && files != &list->fl_prefile)
     {
-      fs_heap_free(list->fl_files);
+      FAR struct file **retired = FILES_RETIRED(files);
+
+      fs_heap_free(files - 1);
+      files = retired;
     }
 }
 
@@ -511,7 +577,7 @@ void files_putlist(FAR struct filelist *list)
 
 int files_countlist(FAR struct filelist *list)
 {
-  return list->fl_rows * CONFIG_NFILE_DESCRIPTORS_PER_BLOCK;
+  return files_rows(list) * CONFIG_NFILE_DESCRIPTORS_PER_BLOCK;
 }
 
 /****************************************************************************
@@ -79,6 +79,10 @@ static FAR struct inode *inode_unlink(FAR const char *path)
       inode = desc.node;
       DEBUGASSERT(inode != NULL);
 
+      /* Forget every cached lookup that may lead to the inode */
+
+      dcache_invalidate(NULL);
+
       /* If peer is non-null, then remove the node from the right of
        * of that peer node.
        */
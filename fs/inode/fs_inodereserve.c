@@ -109,6 +109,10 @@ static void inode_insert(FAR struct inode *inode,
                          FAR struct inode *peer,
                          FAR struct inode *parent)
 {
+  /* The cached peer of the names around the new inode changes */
+
+  dcache_invalidate(NULL);
+
   /* If peer is non-null, then new node simply goes to the right
    * of that peer node.
    */
@@ -43,6 +43,10 @@
  ****************************************************************************/
 
 static int _inode_compare(FAR const char *fname, FAR struct inode *inode);
+static FAR struct inode *_inode_lookup(FAR const char *name,
+                                       FAR struct inode *inode,
+                                       FAR struct inode *above,
+                                       FAR struct inode **left);
 #ifdef CONFIG_PSEUDOFS_SOFTLINKS
 static int _inode_linktarget(FAR struct inode *inode,
                              FAR struct inode_search_s *desc);
@@ -131,6 +135,82 @@ static int _inode_compare(FAR const char *fname, FAR struct inode *inode)
     }
 }
 
+/****************************************************************************
+ * Name: _inode_lookup
+ *
+ * Description:
+ *   Find the first segment of name among inode and its peers to the
+ *   "right".  Return the matching inode, or NULL, and the peer to its
+ *   "left" in *left.  The result of the walk is kept in the lookup cache,
+ *   keyed by the parent inode.
+ *
+ * Assumptions:
+ *   The caller holds the g_inode_sem semaphore
+ *
+ ****************************************************************************/
+
+static FAR struct inode *_inode_lookup(FAR const char *name,
+                                       FAR struct inode *inode,
+                                       FAR struct inode *above,
+                                       FAR struct inode **left)
+{
+  FAR struct inode *peer = NULL;
+#ifdef CONFIG_FS_DCACHE
+  FAR const void *dir = above ? (FAR const void *)above :
+                                (FAR const void *)&g_root_inode;
+  size_t len = strcspn(name, "/");
+  FAR void *node;
+  FAR void *priv;
+
+  if (dcache_lookup(dir, name, len, &node, &priv) == OK)
+    {
+      *left = priv;
+      return node;
+    }
+#endif
+
+  while (inode != NULL)
+    {
+      int result = _inode_compare(name, inode);
+
+      /* Case 1:  The name is less than the name of the node.
+       * Since the names are ordered, these means that there
+       * is no peer node with this name and that there can be
+       * no match in the filesystem.
+       */
+
+      if (result < 0)
+        {
+          inode = NULL;
+          break;
+        }
+
+      /* Case 2: the name is greater than the name of the node.
+       * In this case, the name may still be in the list to the
+       * "right"
+       */
+
+      else if (result > 0)
+        {
+          /* Continue looking to the "right" of this inode. */
+
+          peer  = inode;
+          inode = inode->i_peer;
+        }
+
+      /* Case 3: The names match */
+
+      else
+        {
+          break;
+        }
+    }
+
+  dcache_add(dir, name, len, inode, peer);
+  *left = peer;
+  return inode;
+}
+
 /****************************************************************************
  * Name: _inode_linktarget
  *
@@ -242,33 +322,14 @@ static int _inode_search(FAR struct inode_search_s *desc)
 
   while (inode != NULL)
     {
-      int result = _inode_compare(name, inode);
-
-      /* Case 1:  The name is less than the name of the node.
-       * Since the names are ordered, these means that there
-       * is no peer node with this name and that there can be
-       * no match in the filesystem.
-       */
+      /* Find the name among the peers of this level */
 
-      if (result < 0)
+      inode = _inode_lookup(name, inode, above, &left);
+      if (inode == NULL)
         {
-          inode = NULL;
           break;
         }
 
-      /* Case 2: the name is greater than the name of the node.
-       * In this case, the name may still be in the list to the
-       * "right"
-       */
-
-      else if (result > 0)
-        {
-          /* Continue looking to the "right" of this inode. */
-
-          left  = inode;
-          inode = inode->i_peer;
-        }
-
       /* The names match */
 
       else
@@ -463,6 +463,57 @@ int pseudofile_create(FAR struct inode **node, FAR const char *path,
 bool inode_is_pseudofile(FAR struct inode *inode);
 #endif
 
+#ifdef CONFIG_FS_DCACHE
+
+/****************************************************************************
+ * Name: dcache_lookup
+ *
+ * Description:
+ *   Look up the cached result of a search of name in the directory dir.
+ *   dir is an opaque key: the parent inode for the pseudo file system, or
+ *   any directory object of a mounted file system that opts in.  On a hit,
+ *   *node is the object found or NULL for a cached negative result.
+ *
+ * Returned Value:
+ *   OK if the result is cached, -ENOENT otherwise.
+ *
+ ****************************************************************************/
+
+int dcache_lookup(FAR const void *dir, FAR const char *name, size_t len,
+                  FAR void **node, FAR void **priv);
+
+/****************************************************************************
+ * Name: dcache_add
+ *
+ * Description:
+ *   Remember the result of a search of name in dir.  node is NULL if the
+ *   name does not exist.
+ *
+ ****************************************************************************/
+
+void dcache_add(FAR const void *dir, FAR const char *name, size_t len,
+                FAR void *node, FAR void *priv);
+
+/****************************************************************************
+ * Name: dcache_invalidate
+ *
+ * Description:
+ *   Forget the cached searches in dir, or every cached search if dir is
+ *   NULL.  File systems must call this under their own lock whenever a
+ *   name is added to, removed from or renamed in dir, and before dir is
+ *   freed.  Every change of the pseudo file system tree, including mount
+ *   and umount, invalidates the whole cache.
+ *
+ ****************************************************************************/
+
+void dcache_invalidate(FAR const void *dir);
+
+#else
+#  define dcache_lookup(dir, name, len, node, priv) (-ENOENT)
+#  define dcache_add(dir, name, len, node, priv)
+#  define dcache_invalidate(dir)
+#endif
+
 #undef EXTERN
 #if defined(__cplusplus)
 }
@@ -54,7 +54,11 @@
 #  warning CONFIG_FS_TMPFS_DIRECTORY_FREEGUARD needs to be > ALLOCGUARD
 #endif
 
-#if CONFIG_FS_TMPFS_FILE_FREEGUARD <= CONFIG_FS_TMPFS_FILE_ALLOCGUARD
+#ifdef CONFIG_FS_TMPFS_PAGED
+#  define TMPFS_PAGE_MASK     (CONFIG_FS_TMPFS_PAGESIZE - 1)
+#  define TMPFS_NPAGES(size)  (((size) + TMPFS_PAGE_MASK) / \
+                               CONFIG_FS_TMPFS_PAGESIZE)
+#elif CONFIG_FS_TMPFS_FILE_FREEGUARD <= CONFIG_FS_TMPFS_FILE_ALLOCGUARD
 #  warning CONFIG_FS_TMPFS_FILE_FREEGUARD needs to be > ALLOCGUARD
 #endif
 
@@ -75,6 +79,14 @@
 #define tmpfs_unlock_directory(tdo) \
            nxrmutex_unlock(&tdo->tdo_lock)
 
+#ifdef CONFIG_FS_TMPFS_PAGED
+#  define tmpfs_free_data(tfo) \
+           tmpfs_realloc_file(tfo, 0)
+#else
+#  define tmpfs_free_data(tfo) \
+           fs_heap_free(tfo->tfo_data)
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -94,6 +106,16 @@ struct tmpfs_dir_s
 
 static int  tmpfs_realloc_directory(FAR struct tmpfs_directory_s *tdo,
               unsigned int nentries);
+#ifdef CONFIG_FS_TMPFS_PAGED
+static int  tmpfs_extend_pages(FAR struct tmpfs_file_s *tfo,
+                               size_t npages);
+static FAR uint8_t *tmpfs_page_address(FAR struct tmpfs_file_s *tfo,
+                                       off_t offset, size_t length);
+static void tmpfs_read_pages(FAR struct tmpfs_file_s *tfo, off_t pos,
+                             FAR char *buffer, size_t buflen);
+static ssize_t tmpfs_write_pages(FAR struct tmpfs_file_s *tfo, off_t pos,
+                                 FAR const char *buffer, size_t buflen);
+#endif
 static int  tmpfs_realloc_file(FAR struct tmpfs_file_s *tfo,
               size_t newsize);
 static void tmpfs_release_lockedobject(FAR struct tmpfs_object_s *to);
@@ -268,6 +290,231 @@ static int tmpfs_realloc_directory(FAR struct tmpfs_directory_s *tdo,
   return ret;
 }
 
+#ifdef CONFIG_FS_TMPFS_PAGED
+/****************************************************************************
+ * Name: tmpfs_extend_pages
+ *
+ * Description:
+ *   Make the page table of the file hold at least npages entries.  The
+ *   table grows geometrically and its new entries are holes.
+ *
+ ****************************************************************************/
+
+static int tmpfs_extend_pages(FAR struct tmpfs_file_s *tfo,
+                              size_t npages)
+{
+  FAR uint8_t **newpages;
+  size_t newcount;
+
+  if (npages <= tfo->tfo_npages)
+    {
+      return OK;
+    }
+
+  newcount = tfo->tfo_npages * 2;
+  if (newcount < npages)
+    {
+      newcount = npages;
+    }
+
+  newpages = fs_heap_realloc(tfo->tfo_pages,
+                             newcount * sizeof(FAR uint8_t *));
+  if (newpages == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  memset(&newpages[tfo->tfo_npages], 0,
+         (newcount - tfo->tfo_npages) * sizeof(FAR uint8_t *));
+
+  tfo->tfo_alloc += (newcount - tfo->tfo_npages) * sizeof(FAR uint8_t *);
+  tfo->tfo_npages = newcount;
+  tfo->tfo_pages  = newpages;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: tmpfs_page_address
+ *
+ * Description:
+ *   Return the address of a range of the file, or NULL if the range does
+ *   not lie within a single allocated page.
+ *
+ ****************************************************************************/
+
+static FAR uint8_t *tmpfs_page_address(FAR struct tmpfs_file_s *tfo,
+                                       off_t offset, size_t length)
+{
+  size_t ndx = offset / CONFIG_FS_TMPFS_PAGESIZE;
+  size_t pgoff = offset & TMPFS_PAGE_MASK;
+
+  if (ndx >= tfo->tfo_npages || tfo->tfo_pages[ndx] == NULL ||
+      pgoff + length > CONFIG_FS_TMPFS_PAGESIZE)
+    {
+      return NULL;
+    }
+
+  return tfo->tfo_pages[ndx] + pgoff;
+}
+
+/****************************************************************************
+ * Name: tmpfs_read_pages
+ *
+ * Description:
+ *   Copy a range of the file, which must lie within the file size, to the
+ *   buffer.  The holes read as zeroes.
+ *
+ ****************************************************************************/
+
+static void tmpfs_read_pages(FAR struct tmpfs_file_s *tfo, off_t pos,
+                             FAR char *buffer, size_t buflen)
+{
+  size_t ndx;
+  size_t pgoff;
+  size_t n;
+
+  while (buflen > 0)
+    {
+      ndx   = pos / CONFIG_FS_TMPFS_PAGESIZE;
+      pgoff = pos & TMPFS_PAGE_MASK;
+      n     = CONFIG_FS_TMPFS_PAGESIZE - pgoff;
+      if (n > buflen)
+        {
+          n = buflen;
+        }
+
+      if (ndx < tfo->tfo_npages && tfo->tfo_pages[ndx] != NULL)
+        {
+          memcpy(buffer, tfo->tfo_pages[ndx] + pgoff, n);
+        }
+      else
+        {
+          memset(buffer, 0, n);
+        }
+
+      buffer += n;
+      buflen -= n;
+      pos    += n;
+    }
+}
+
+/****************************************************************************
+ * Name: tmpfs_write_pages
+ *
+ * Description:
+ *   Copy the buffer to a range of the file, allocating the pages that are
+ *   written for the first time.  The file size is not updated.
+ *
+ * Returned Value:
+ *   The number of bytes written, which is less than buflen if the memory
+ *   ran out, or -ENOMEM if nothing could be written.
+ *
+ ****************************************************************************/
+
+static ssize_t tmpfs_write_pages(FAR struct tmpfs_file_s *tfo, off_t pos,
+                                 FAR const char *buffer, size_t buflen)
+{
+  FAR uint8_t *page;
+  size_t nwritten = 0;
+  size_t ndx;
+  size_t pgoff;
+  size_t n;
+  int ret;
+
+  ret = tmpfs_extend_pages(tfo, TMPFS_NPAGES((size_t)pos + buflen));
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  while (nwritten < buflen)
+    {
+      ndx   = pos / CONFIG_FS_TMPFS_PAGESIZE;
+      pgoff = pos & TMPFS_PAGE_MASK;
+      n     = CONFIG_FS_TMPFS_PAGESIZE - pgoff;
+      if (n > buflen - nwritten)
+        {
+          n = buflen - nwritten;
+        }
+
+      page = tfo->tfo_pages[ndx];
+      if (page == NULL)
+        {
+          /* A new page, zero the parts that are not written */
+
+          page = fs_heap_malloc(CONFIG_FS_TMPFS_PAGESIZE);
+          if (page == NULL)
+            {
+              break;
+            }
+
+          memset(page, 0, pgoff);
+          memset(page + pgoff + n, 0,
+                 CONFIG_FS_TMPFS_PAGESIZE - pgoff - n);
+
+          tfo->tfo_pages[ndx] = page;
+          tfo->tfo_alloc     += CONFIG_FS_TMPFS_PAGESIZE;
+        }
+
+      memcpy(page + pgoff, buffer + nwritten, n);
+      nwritten += n;
+      pos      += n;
+    }
+
+  return nwritten > 0 || buflen == 0 ? (ssize_t)nwritten : -ENOMEM;
+}
+
+/****************************************************************************
+ * Name: tmpfs_realloc_file
+ *
+ * Description:
+ *   Change the size of the file.  Growing it only adds a hole.  Shrinking
+ *   it frees the pages past the new end and zeroes the rest of the last
+ *   page, so that growing it again reads zeroes.
+ *
+ ****************************************************************************/
+
+static int tmpfs_realloc_file(FAR struct tmpfs_file_s *tfo,
+                              size_t newsize)
+{
+  size_t first = TMPFS_NPAGES(newsize);
+  size_t pgoff = newsize & TMPFS_PAGE_MASK;
+  size_t ndx;
+
+  if (newsize < tfo->tfo_size || newsize == 0)
+    {
+      for (ndx = first; ndx < tfo->tfo_npages; ndx++)
+        {
+          if (tfo->tfo_pages[ndx] != NULL)
+            {
+              fs_heap_free(tfo->tfo_pages[ndx]);
+              tfo->tfo_pages[ndx] = NULL;
+              tfo->tfo_alloc     -= CONFIG_FS_TMPFS_PAGESIZE;
+            }
+        }
+
+      if (pgoff != 0 && first <= tfo->tfo_npages &&
+          tfo->tfo_pages[first - 1] != NULL)
+        {
+          memset(tfo->tfo_pages[first - 1] + pgoff, 0,
+                 CONFIG_FS_TMPFS_PAGESIZE - pgoff);
+        }
+
+      if (newsize == 0)
+        {
+          /* Free the page table too */
+
+          fs_heap_free(tfo->tfo_pages);
+          tfo->tfo_pages  = NULL;
+          tfo->tfo_npages = 0;
+          tfo->tfo_alloc  = 0;
+        }
+    }
+
+  tfo->tfo_size = newsize;
+  return OK;
+}
+#else
 /****************************************************************************
  * Name: tmpfs_realloc_file
  ****************************************************************************/
@@ -345,6 +592,7 @@ static int tmpfs_realloc_file(FAR struct tmpfs_file_s *tfo,
   tfo->tfo_data  = newdata;
   return OK;
 }
+#endif /* CONFIG_FS_TMPFS_PAGED */
 
 /****************************************************************************
  * Name: tmpfs_release_lockedobject
@@ -383,7 +631,7 @@ static void tmpfs_release_lockedfile(FAR struct tmpfs_file_s *tfo)
     {
       tmpfs_unlock_file(tfo);
       nxrmutex_destroy(&tfo->tfo_lock);
-      fs_heap_free(tfo->tfo_data);
+      tmpfs_free_data(tfo);
       fs_heap_free(tfo);
     }
 
@@ -472,6 +720,8 @@ static int tmpfs_remove_dirent(FAR struct tmpfs_directory_s *tdo,
       return index;
     }
 
+  dcache_invalidate(tdo);
+
   /* Free the object name */
 
   if (tdo->tdo_entry[index].tde_name != NULL)
@@ -545,6 +795,10 @@ static int tmpfs_add_dirent(FAR struct tmpfs_directory_s *tdo,
       return index;
     }
 
+  /* Drop the negative lookups of the new name */
+
+  dcache_invalidate(tdo);
+
   /* Save the new object info in the new directory entry */
 
   to->to_parent   = tdo;
@@ -582,7 +836,12 @@ tmpfs_alloc_file(FAR struct tmpfs_directory_s *parent)
   tfo->tfo_parent = parent;
   tfo->tfo_flags  = 0;
   tfo->tfo_size   = 0;
+#ifdef CONFIG_FS_TMPFS_PAGED
+  tfo->tfo_npages = 0;
+  tfo->tfo_pages  = NULL;
+#else
   tfo->tfo_data   = NULL;
+#endif
 
   nxrmutex_init(&tfo->tfo_lock);
   tmpfs_lock_file(tfo);
@@ -874,6 +1133,9 @@ static int tmpfs_find_object(FAR struct tmpfs_s *fs,
   FAR struct tmpfs_directory_s *next_tdo;
   FAR const char *segment;
   FAR const char *next_segment;
+#ifdef CONFIG_FS_DCACHE
+  FAR void *node;
+#endif
   int index;
   int ret;
 
@@ -916,15 +1178,36 @@ static int tmpfs_find_object(FAR struct tmpfs_s *fs,
        * directory.
        */
 
-      index = tmpfs_find_dirent(tdo, segment, next_segment - segment);
-      if (index < 0)
+#ifdef CONFIG_FS_DCACHE
+      if (dcache_lookup(tdo, segment, next_segment - segment,
+                        &node, NULL) == OK)
         {
-          /* No object with this name exists in the directory. */
+          if (node == NULL)
+            {
+              return -ENOENT;
+            }
 
-          return index;
+          to = node;
         }
+      else
+#endif
+        {
+          index = tmpfs_find_dirent(tdo, segment, next_segment - segment);
+          if (index == -ENOENT)
+            {
+              dcache_add(tdo, segment, next_segment - segment, NULL, NULL);
+            }
+
+          if (index < 0)
+            {
+              /* No object with this name exists in the directory. */
+
+              return index;
+            }
 
-      to = tdo->tdo_entry[index].tde_object;
+          to = tdo->tdo_entry[index].tde_object;
+          dcache_add(tdo, segment, next_segment - segment, to, NULL);
+        }
 
       /* Is this object another directory? */
 
@@ -1189,7 +1472,13 @@ static int tmpfs_statfs_callout(FAR struct tmpfs_directory_s *tdo,
 
       tmptfo             = (FAR struct tmpfs_file_s *)to;
       tmpbuf->tsf_alloc += sizeof(struct tmpfs_file_s);
-      tmpbuf->tsf_avail += to->to_alloc - tmptfo->tfo_size;
+      if (to->to_alloc > tmptfo->tfo_size)
+        {
+          /* The holes of a sparse file are not allocated */
+
+          tmpbuf->tsf_avail += to->to_alloc - tmptfo->tfo_size;
+        }
+
       tmpbuf->tsf_files++;
     }
   else /* if (to->to_type == TMPFS_DIRECTORY) */
@@ -1265,7 +1554,7 @@ static int tmpfs_free_callout(FAR struct tmpfs_directory_s *tdo,
           return TMPFS_UNLINKED;
         }
 
-      fs_heap_free(tfo->tfo_data);
+      tmpfs_free_data(tfo);
     }
   else /* if (to->to_type == TMPFS_DIRECTORY) */
     {
@@ -1586,6 +1875,10 @@ static ssize_t tmpfs_read(FAR struct file *filep, FAR char *buffer,
 
   /* Copy data from the memory object to the user buffer */
 
+#ifdef CONFIG_FS_TMPFS_PAGED
+  tmpfs_read_pages(tfo, startpos, buffer, nread);
+  filep->f_pos += nread;
+#else
   if (tfo->tfo_data != NULL)
     {
       memcpy(buffer, &tfo->tfo_data[startpos], nread);
@@ -1595,6 +1888,7 @@ static ssize_t tmpfs_read(FAR struct file *filep, FAR char *buffer,
     {
       DEBUGASSERT(tfo->tfo_size == 0 && nread == 0);
     }
+#endif
 
   /* Release the lock on the file */
 
@@ -1642,6 +1936,22 @@ static ssize_t tmpfs_write(FAR struct file *filep, FAR const char *buffer,
       startpos = filep->f_pos;
     }
 
+#ifdef CONFIG_FS_TMPFS_PAGED
+  /* Copy data from the user buffer to the pages of the file */
+
+  nwritten = tmpfs_write_pages(tfo, startpos, buffer, buflen);
+  if (nwritten < 0)
+    {
+      ret = nwritten;
+      goto errout_with_lock;
+    }
+
+  endpos = startpos + nwritten;
+  if (endpos > tfo->tfo_size)
+    {
+      tfo->tfo_size = endpos;
+    }
+#else
   nwritten = buflen;
   endpos   = startpos + buflen;
 
@@ -1666,6 +1976,7 @@ static ssize_t tmpfs_write(FAR struct file *filep, FAR const char *buffer,
     {
       DEBUGASSERT(tfo->tfo_size == 0 && nwritten == 0);
     }
+#endif
 
   filep->f_pos = endpos;
 
@@ -1788,7 +2099,19 @@ static int tmpfs_mmap(FAR struct file *filep, FAR struct mm_map_entry_s *map)
   if (map->offset >= 0 && map->offset < tfo->tfo_size &&
       map->length && map->offset + map->length <= tfo->tfo_size)
     {
+#ifdef CONFIG_FS_TMPFS_PAGED
+      /* Only a range within one page is mapped in place.  -ENOTTY lets
+       * rammap() copy the others; FS_TMPFS_PAGED selects FS_RAMMAP.
+       */
+
+      map->vaddr = tmpfs_page_address(tfo, map->offset, map->length);
+      if (map->vaddr == NULL)
+        {
+          return -ENOTTY;
+        }
+#else
       map->vaddr = tfo->tfo_data + map->offset;
+#endif
       map->priv.p = tfo;
       map->munmap = tmpfs_unmap;
       ret = mm_map_add(get_current_mm(), map);
@@ -1842,8 +2165,15 @@ static int tmpfs_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
     {
       FAR uintptr_t *ptr = (FAR uintptr_t *)arg;
 
+#ifdef CONFIG_FS_TMPFS_PAGED
+      /* Only a file held in one page is contiguous */
+
+      *ptr = (uintptr_t)tmpfs_page_address(tfo, 0, tfo->tfo_size);
+      return *ptr != 0 ? OK : -ENOTTY;
+#else
       *ptr = (uintptr_t)tfo->tfo_data;
       return OK;
+#endif
     }
 
   return ret;
@@ -1976,6 +2306,7 @@ static int tmpfs_truncate(FAR struct file *filep, off_t length)
           goto errout_with_lock;
         }
 
+#ifndef CONFIG_FS_TMPFS_PAGED
       /* If the size has increased, then we need to zero the newly added
        * memory.
        */
@@ -1984,6 +2315,7 @@ static int tmpfs_truncate(FAR struct file *filep, off_t length)
         {
           memset(&tfo->tfo_data[oldsize], 0, length - oldsize);
         }
+#endif
 
       ret = OK;
     }
@@ -2256,8 +2588,11 @@ static int tmpfs_unbind(FAR void *handle, FAR struct inode **blkdriver,
   tdo = (FAR struct tmpfs_directory_s *)fs->tfs_root.tde_object;
   ret = tmpfs_foreach(tdo, tmpfs_free_callout, NULL);
 
-  /* Now we can destroy the root file system and the file system itself. */
+  /* Now we can destroy the root file system and the file system itself.
+   * None of the cached lookups of its directories may survive.
+   */
 
+  dcache_invalidate(NULL);
   nxrmutex_destroy(&tdo->tdo_lock);
   fs_heap_free(tdo->tdo_entry);
   fs_heap_free(tdo);
@@ -2426,7 +2761,7 @@ static int tmpfs_unlink(FAR struct inode *mountpt, FAR const char *relpath)
   else
     {
       nxrmutex_destroy(&tfo->tfo_lock);
-      fs_heap_free(tfo->tfo_data);
+      tmpfs_free_data(tfo);
       fs_heap_free(tfo);
     }
 
@@ -2567,6 +2902,7 @@ static int tmpfs_rmdir(FAR struct inode *mountpt, FAR const char *relpath)
 
   /* Free the directory object */
 
+  dcache_invalidate(tdo);
   nxrmutex_destroy(&tdo->tdo_lock);
   fs_heap_free(tdo->tdo_entry);
   fs_heap_free(tdo);
@@ -36,12 +36,14 @@
 #include <debug.h>
 
 #include <nuttx/nuttx.h>
+#include <nuttx/atomic.h>
 #include <nuttx/clock.h>
 #include <nuttx/fs/fs.h>
 #include <nuttx/kmalloc.h>
 #include <nuttx/list.h>
 #include <nuttx/mutex.h>
 #include <nuttx/signal.h>
+#include <nuttx/spinlock.h>
 
 #include "inode/inode.h"
 #include "fs_heap.h"
@@ -53,8 +55,8 @@
 struct epoll_node_s
 {
   struct list_node         node;
+  struct list_node         rnode;  /* Link in the ready list */
   epoll_data_t             data;
-  bool                     notified;
   struct pollfd            pfd;
   FAR struct epoll_head_s *eph;
 };
@@ -67,13 +69,21 @@ struct epoll_head_s
   int                   crefs;
   mutex_t               lock;
   sem_t                 sem;
+  spinlock_t            rlock;    /* Protects the ready list, which is
+                                   * updated from the poll callback.
+                                   */
+  struct list_node      ready;    /* The ready list, store the setuped epoll
+                                   * nodes notified by their driver and not
+                                   * yet reported by epoll_wait.
+                                   */
   struct list_node      setup;    /* The setup list, store all the setuped
                                    * epoll node.
                                    */
-  struct list_node      teardown; /* The teardown list, store all the epoll
-                                   * node notified after epoll_wait finish,
-                                   * these epoll node should be setup again
-                                   * to check the pending poll notification.
+  struct list_node      teardown; /* The teardown list, store the level
+                                   * triggered epoll nodes reported by the
+                                   * last epoll_wait, these epoll node should
+                                   * be setup again to check whether the
+                                   * event is still pending.
                                    */
   struct list_node      oneshot;  /* The oneshot list, store all the epoll
                                    * node notified after epoll_wait and with
@@ -101,6 +111,7 @@ static int epoll_do_close(FAR struct file *filep);
 static int epoll_do_poll(FAR struct file *filep,
                          FAR struct pollfd *fds, bool setup);
 static int epoll_setup(FAR epoll_head_t *eph);
+static bool epoll_isready(FAR epoll_head_t *eph);
 static int epoll_teardown(FAR epoll_head_t *eph, FAR struct epoll_event *evs,
                           int maxevents);
 
@@ -237,11 +248,13 @@ static int epoll_do_create(int size, int flags)
   eph->size = size;
   nxmutex_init(&eph->lock);
   nxsem_init(&eph->sem, 0, 0);
+  spin_lock_init(&eph->rlock);
 
   /* List initialize */
 
   epn = (FAR epoll_node_t *)(eph + 1);
 
+  list_initialize(&eph->ready);
   list_initialize(&eph->setup);
   list_initialize(&eph->teardown);
   list_initialize(&eph->oneshot);
@@ -268,11 +281,64 @@ static int epoll_do_create(int size, int flags)
   return fd;
 }
 
+/****************************************************************************
+ * Name: epoll_unready
+ *
+ * Description:
+ *   Remove the epoll node from the ready list, if it is queued there.
+ *
+ * Input Parameters:
+ *   epn       - The epoll node pointer
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+static void epoll_unready(FAR epoll_node_t *epn)
+{
+  irqstate_t flags;
+
+  flags = spin_lock_irqsave(&epn->eph->rlock);
+  if (list_in_list(&epn->rnode))
+    {
+      list_delete(&epn->rnode);
+    }
+
+  spin_unlock_irqrestore(&epn->eph->rlock, flags);
+}
+
+/****************************************************************************
+ * Name: epoll_isready
+ *
+ * Description:
+ *   Check whether any epoll node is waiting in the ready list.
+ *
+ * Input Parameters:
+ *   eph       - The epoll head pointer
+ *
+ * Returned Value:
+ *   True if the ready list is not empty
+ *
+ ****************************************************************************/
+
+static bool epoll_isready(FAR epoll_head_t *eph)
+{
+  irqstate_t flags;
+  bool ready;
+
+  flags = spin_lock_irqsave(&eph->rlock);
+  ready = !list_is_empty(&eph->ready);
+  spin_unlock_irqrestore(&eph->rlock, flags);
+  return ready;
+}
+
 /****************************************************************************
  * Name: epoll_setup
  *
  * Description:
- *   Setup all the fd.
+ *   Setup again the level triggered fd reported by the last epoll_wait.
+ *   The other fd stay setup between the calls.
  *
  * Input Parameters:
  *   eph       - The epoll head pointer
@@ -296,11 +362,10 @@ static int epoll_setup(FAR epoll_head_t *eph)
 
   list_for_every_entry_safe(&eph->teardown, epn, tepn, epoll_node_t, node)
     {
-      /* Setup again to check the notified pollfd last epoll_wait() to
-       * cover the situation several poll event pending on one fd.
+      /* Setup again to check whether the event reported by the last
+       * epoll_wait() is still pending on the fd.
        */
 
-      epn->notified    = false;
       epn->pfd.revents = 0;
       ret = poll_fdsetup(epn->pfd.fd, &epn->pfd, true);
       if (ret < 0)
@@ -322,8 +387,12 @@ static int epoll_setup(FAR epoll_head_t *eph)
  * Name: epoll_teardown
  *
  * Description:
- *   Teardown all the notifed fd and check the notified fd's event with user
- *   expected event.
+ *   Take the notified fd from the ready list and report their events.  Only
+ *   the ready fd are visited, so the cost does not depend on the number of
+ *   registered fd.  A reported fd is torn down and moved to the oneshot
+ *   list if EPOLLONESHOT is set.  Otherwise, with EPOLLET it stays setup
+ *   and is reported again on the next notification by its driver, and
+ *   without it is torn down to be setup again by the next epoll_wait.
  *
  * Input Parameters:
  *   eph       - The epoll head pointer
@@ -339,41 +408,56 @@ static int epoll_setup(FAR epoll_head_t *eph)
 static int epoll_teardown(FAR epoll_head_t *eph, FAR struct epoll_event *evs,
                           int maxevents)
 {
-  FAR epoll_node_t *tepn;
+  FAR struct list_node *rnode;
   FAR epoll_node_t *epn;
+  pollevent_t revents;
+  irqstate_t flags;
   int i = 0;
 
   nxmutex_lock(&eph->lock);
 
-  list_for_every_entry_safe(&eph->setup, epn, tepn, epoll_node_t, node)
+  while (i < maxevents)
     {
-      /* Only check the notifed fd */
+      /* Take the next notified fd and consume its events, a notification
+       * arriving after this point queues the fd again.
+       */
 
-      if (!epn->notified)
+      flags = spin_lock_irqsave(&eph->rlock);
+      rnode = list_remove_head(&eph->ready);
+      if (rnode == NULL)
         {
-          continue;
+          spin_unlock_irqrestore(&eph->rlock, flags);
+          break;
         }
 
-      /* Teradown all the notified fd */
+      /* poll_notify() merges into revents without rlock, so the events
+       * are taken and cleared in one atomic operation.
+       */
 
-      poll_fdsetup(epn->pfd.fd, &epn->pfd, false);
-      list_delete(&epn->node);
+      epn     = container_of(rnode, epoll_node_t, rnode);
+      revents = atomic_xchg((FAR atomic_t *)&epn->pfd.revents, 0);
+      spin_unlock_irqrestore(&eph->rlock, flags);
+
+      if (revents == 0)
+        {
+          continue;
+        }
+
+      evs[i].data     = epn->data;
+      evs[i++].events = revents;
 
-      if (epn->pfd.revents != 0 && i < maxevents)
+      if ((epn->pfd.events & EPOLLONESHOT) != 0)
         {
-          evs[i].data     = epn->data;
-          evs[i++].events = epn->pfd.revents;
-          if ((epn->pfd.events & EPOLLONESHOT) != 0)
-            {
-              list_add_tail(&eph->oneshot, &epn->node);
-            }
-          else
-            {
-              list_add_tail(&eph->teardown, &epn->node);
-            }
+          poll_fdsetup(epn->pfd.fd, &epn->pfd, false);
+          epoll_unready(epn);
+          list_delete(&epn->node);
+          list_add_tail(&eph->oneshot, &epn->node);
         }
-      else
+      else if ((epn->pfd.events & EPOLLET) == 0)
         {
+          poll_fdsetup(epn->pfd.fd, &epn->pfd, false);
+          epoll_unready(epn);
+          list_delete(&epn->node);
           list_add_tail(&eph->teardown, &epn->node);
         }
     }
@@ -400,16 +484,26 @@ static int epoll_teardown(FAR epoll_head_t *eph, FAR struct epoll_event *evs,
 static void epoll_default_cb(FAR struct pollfd *fds)
 {
   FAR epoll_node_t *epn = fds->arg;
+  FAR epoll_head_t *eph = epn->eph;
+  irqstate_t flags;
   int semcount = 0;
 
-  epn->notified = true;
-  if (fds->revents != 0)
+  /* Queue the node to the ready list, epoll_teardown() skips it if the
+   * events were already consumed.
+   */
+
+  flags = spin_lock_irqsave(&eph->rlock);
+  if (!list_in_list(&epn->rnode))
     {
-      nxsem_get_value(&epn->eph->sem, &semcount);
-      if (semcount < 1)
-        {
-          nxsem_post(&epn->eph->sem);
-        }
+      list_add_tail(&eph->ready, &epn->rnode);
+    }
+
+  spin_unlock_irqrestore(&eph->rlock, flags);
+
+  nxsem_get_value(&eph->sem, &semcount);
+  if (semcount < 1)
+    {
+      nxsem_post(&eph->sem);
     }
 }
 
@@ -558,16 +652,18 @@ int epoll_ctl(int epfd, int op, int fd, FAR struct epoll_event *ev)
         epn = container_of(list_remove_head(&eph->free), epoll_node_t, node);
         epn->eph         = eph;
         epn->data        = ev->data;
-        epn->notified    = false;
-        epn->pfd.events  = ev->events | POLLALWAYS;
+        epn->pfd.events  = ev->events;
         epn->pfd.fd      = fd;
         epn->pfd.arg     = epn;
         epn->pfd.cb      = epoll_default_cb;
         epn->pfd.revents = 0;
 
+        list_clear_node(&epn->rnode);
+
         ret = poll_fdsetup(fd, &epn->pfd, true);
         if (ret < 0)
           {
+            epoll_unready(epn);
             list_add_tail(&eph->free, &epn->node);
             goto err;
           }
@@ -582,6 +678,7 @@ int epoll_ctl(int epfd, int op, int fd, FAR struct epoll_event *ev)
             if (epn->pfd.fd == fd)
               {
                 poll_fdsetup(fd, &epn->pfd, false);
+                epoll_unready(epn);
                 list_delete(&epn->node);
                 list_add_tail(&eph->free, &epn->node);
                 goto out;
@@ -616,21 +713,23 @@ int epoll_ctl(int epfd, int op, int fd, FAR struct epoll_event *ev)
           {
             if (epn->pfd.fd == fd)
               {
-                if (epn->pfd.events != (ev->events | POLLALWAYS))
+                /* Setup again even if the events are unchanged, as ADD
+                 * does, so that an event already pending on the fd is
+                 * reported.
+                 */
+
+                poll_fdsetup(fd, &epn->pfd, false);
+                epoll_unready(epn);
+
+                epn->data        = ev->data;
+                epn->pfd.events  = ev->events;
+                epn->pfd.fd      = fd;
+                epn->pfd.revents = 0;
+
+                ret = poll_fdsetup(fd, &epn->pfd, true);
+                if (ret < 0)
                   {
-                    poll_fdsetup(fd, &epn->pfd, false);
-
-                    epn->notified    = false;
-                    epn->data        = ev->data;
-                    epn->pfd.events  = ev->events | POLLALWAYS;
-                    epn->pfd.fd      = fd;
-                    epn->pfd.revents = 0;
-
-                    ret = poll_fdsetup(fd, &epn->pfd, true);
-                    if (ret < 0)
-                      {
-                        goto err;
-                      }
+                    goto err;
                   }
 
                 goto out;
@@ -641,24 +740,19 @@ int epoll_ctl(int epfd, int op, int fd, FAR struct epoll_event *ev)
           {
             if (epn->pfd.fd == fd)
               {
-                if (epn->pfd.events != (ev->events | POLLALWAYS))
+                epn->data        = ev->data;
+                epn->pfd.events  = ev->events;
+                epn->pfd.fd      = fd;
+                epn->pfd.revents = 0;
+
+                ret = poll_fdsetup(fd, &epn->pfd, true);
+                if (ret < 0)
                   {
-                    epn->notified    = false;
-                    epn->data        = ev->data;
-                    epn->pfd.events  = ev->events | POLLALWAYS;
-                    epn->pfd.fd      = fd;
-                    epn->pfd.revents = 0;
-
-                    ret = poll_fdsetup(fd, &epn->pfd, true);
-                    if (ret < 0)
-                      {
-                        goto err;
-                      }
-
-                    list_delete(&epn->node);
-                    list_add_tail(&eph->setup, &epn->node);
+                    goto err;
                   }
 
+                list_delete(&epn->node);
+                list_add_tail(&eph->setup, &epn->node);
                 goto out;
               }
           }
@@ -667,9 +761,8 @@ int epoll_ctl(int epfd, int op, int fd, FAR struct epoll_event *ev)
           {
             if (epn->pfd.fd == fd)
               {
-                epn->notified    = false;
                 epn->data        = ev->data;
-                epn->pfd.events  = ev->events | POLLALWAYS;
+                epn->pfd.events  = ev->events;
                 epn->pfd.fd      = fd;
                 epn->pfd.revents = 0;
 
@@ -733,9 +826,9 @@ retry:
 
   nxsig_procmask(SIG_SETMASK, sigmask, &oldsigmask);
 
-  if (timeout == 0)
+  if (timeout == 0 || epoll_isready(eph))
     {
-      ret = -ETIMEDOUT;
+      ret = timeout == 0 ? -ETIMEDOUT : OK;
     }
   else if (timeout > 0)
     {
@@ -806,9 +899,9 @@ retry:
 
   /* Wait the poll ready */
 
-  if (timeout == 0)
+  if (timeout == 0 || epoll_isready(eph))
     {
-      ret = -ETIMEDOUT;
+      ret = timeout == 0 ? -ETIMEDOUT : OK;
     }
   else if (timeout > 0)
     {
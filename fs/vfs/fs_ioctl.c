@@ -230,6 +230,47 @@ int file_ioctl(FAR struct file *filep, int req, ...)
   return ret;
 }
 
+/****************************************************************************
+ * Name: file_xipbase
+ *
+ * Description:
+ *   Return the address of the data of a file that is directly addressable
+ *   and cannot change while the file is open, so that it may be used after
+ *   the file lock is released.  Only a file system that cannot write its
+ *   files qualifies:  tmpfs also answers FIOC_XIPBASE, but its buffer is
+ *   reallocated when the file is written or truncated.
+ *
+ *   mmap() is not used as a fallback:  tmpfs maps the same buffer in
+ *   place, and the other file systems copy the file into RAM (rammap),
+ *   which costs the copy this interface is meant to avoid.
+ *
+ * Input Parameters:
+ *   filep   - File structure instance
+ *   xipbase - The location to return the address of the data
+ *
+ * Returned Value:
+ *   Zero (OK) on success; a negated errno value on failure.  -ENOTTY is
+ *   returned if the data is not directly addressable or may move.
+ *
+ ****************************************************************************/
+
+int file_xipbase(FAR struct file *filep, FAR uintptr_t *xipbase)
+{
+#ifndef CONFIG_DISABLE_MOUNTPOINT
+  FAR struct inode *inode = filep->f_inode;
+
+  if (inode != NULL && INODE_IS_MOUNTPT(inode) &&
+      inode->u.i_mops->write == NULL && inode->u.i_mops->writev == NULL &&
+      inode->u.i_mops->truncate == NULL)
+    {
+      return file_ioctl(filep, FIOC_XIPBASE,
+                        (unsigned long)((uintptr_t)xipbase));
+    }
+#endif
+
+  return -ENOTTY;
+}
+
 /****************************************************************************
  * Name: ioctl
  *
@@ -32,6 +32,7 @@
 #include <errno.h>
 #include <debug.h>
 
+#include <nuttx/atomic.h>
 #include <nuttx/clock.h>
 #include <nuttx/semaphore.h>
 #include <nuttx/cancelpt.h>
@@ -277,6 +278,7 @@ void poll_notify(FAR struct pollfd **afds, int nfds, pollevent_t eventset)
 {
   int i;
   FAR struct pollfd *fds;
+  pollevent_t revents;
 
   DEBUGASSERT(afds != NULL && nfds >= 1);
 
@@ -285,20 +287,25 @@ void poll_notify(FAR struct pollfd **afds, int nfds, pollevent_t eventset)
       fds = afds[i];
       if (fds != NULL)
         {
-          /* The error event must be set in fds->revents */
+          /* The error event must be set in fds->revents.  The events are
+           * merged atomically: epoll consumes them concurrently.
+           */
 
-          fds->revents |= eventset & (fds->events | POLLERR | POLLHUP);
-          if ((fds->revents & (POLLERR | POLLHUP)) != 0)
+          revents  = eventset & (fds->events | POLLERR | POLLHUP);
+          revents |= atomic_fetch_or((FAR atomic_t *)&fds->revents,
+                                     revents);
+          if ((revents & (POLLERR | POLLHUP)) != 0)
             {
               /* Error or Hung up, clear POLLOUT event */
 
-              fds->revents &= ~POLLOUT;
+              atomic_fetch_and((FAR atomic_t *)&fds->revents, ~POLLOUT);
+              revents &= ~POLLOUT;
             }
 
-          if ((fds->revents != 0 || (fds->events & POLLALWAYS) != 0) &&
+          if ((revents != 0 || (fds->events & POLLALWAYS) != 0) &&
               fds->cb != NULL)
             {
-              finfo("Report events: %08" PRIx32 "\n", fds->revents);
+              finfo("Report events: %08" PRIx32 "\n", revents);
               fds->cb(fds);
             }
         }
@@ -27,11 +27,13 @@
 #include <nuttx/config.h>
 
 #include <sys/sendfile.h>
+#include <sys/stat.h>
 #include <stdbool.h>
 #include <errno.h>
 #include <debug.h>
 
 #include <nuttx/fs/fs.h>
+#include <nuttx/fs/ioctl.h>
 #include <nuttx/kmalloc.h>
 #include <nuttx/net/net.h>
 #include "fs_heap.h"
@@ -40,11 +42,84 @@
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: copyfile_xip
+ *
+ * Description:
+ *   Write the data of a directly addressable, immutable file (romfs XIP)
+ *   from where it lies, without going through a bounce buffer.  The
+ *   position of the input file is moved past the data written.
+ *
+ ****************************************************************************/
+
+static ssize_t copyfile_xip(FAR struct file *outfile,
+                            FAR struct file *infile,
+                            FAR const uint8_t *xipbase, size_t count)
+{
+  ssize_t nbyteswritten;
+  size_t ntransferred = 0;
+  struct stat st;
+  off_t pos;
+  int ret;
+
+  pos = file_seek(infile, 0, SEEK_CUR);
+  if (pos < 0)
+    {
+      return pos;
+    }
+
+  ret = file_fstat(infile, &st);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  /* Don't go past the end of file, as file_read() would not */
+
+  if (pos >= st.st_size)
+    {
+      return 0;
+    }
+
+  if (count > st.st_size - pos)
+    {
+      count = st.st_size - pos;
+    }
+
+  while (ntransferred < count)
+    {
+      nbyteswritten = file_write(outfile, xipbase + pos + ntransferred,
+                                 count - ntransferred);
+      if (nbyteswritten >= 0)
+        {
+          ntransferred += nbyteswritten;
+        }
+
+      /* EINTR only stops the copy if nothing was transferred, as in
+       * copyfile().
+       */
+
+      else if (nbyteswritten != -EINTR || ntransferred == 0)
+        {
+          return nbyteswritten;
+        }
+    }
+
+  pos = file_seek(infile, pos + ntransferred, SEEK_SET);
+  if (pos < 0)
+    {
+      return pos;
+    }
+
+  return ntransferred;
+}
+
 static ssize_t copyfile(FAR struct file *outfile, FAR struct file *infile,
                         FAR off_t *offset, size_t count)
 {
   FAR uint8_t *iobuffer;
   FAR uint8_t *wrbuffer;
+  uintptr_t xipbase;
   off_t startpos = 0;
   ssize_t nbytesread;
   ssize_t nbyteswritten;
@@ -74,6 +149,17 @@ static ssize_t copyfile(FAR struct file *outfile, FAR struct file *infile,
         }
     }
 
+  /* Data that is directly addressable needs no I/O buffer.  The data must
+   * not move while it is written, see file_xipbase().
+   */
+
+  if (file_xipbase(infile, &xipbase) >= 0)
+    {
+      ntransferred = copyfile_xip(outfile, infile,
+                                  (FAR const uint8_t *)xipbase, count);
+      goto out;
+    }
+
   /* Allocate an I/O buffer */
 
   iobuffer = fs_heap_malloc(CONFIG_SENDFILE_BUFSIZE);
@@ -201,6 +287,8 @@ static ssize_t copyfile(FAR struct file *outfile, FAR struct file *infile,
 
   fs_heap_free(iobuffer);
 
+out:
+
   /* Return the current file position */
 
   if (offset)
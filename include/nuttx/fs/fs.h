@@ -1651,6 +1651,25 @@ int file_munmap(FAR void *start, size_t length);
 
 int file_ioctl(FAR struct file *filep, int req, ...);
 
+/****************************************************************************
+ * Name: file_xipbase
+ *
+ * Description:
+ *   Return the address of the data of a file that is directly addressable
+ *   and cannot change while the file is open (e.g. a romfs file in XIP
+ *   memory).
+ *
+ * Input Parameters:
+ *   filep   - File structure instance
+ *   xipbase - The location to return the address of the data
+ *
+ * Returned Value:
+ *   Zero (OK) on success; a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int file_xipbase(FAR struct file *filep, FAR uintptr_t *xipbase);
+
 /****************************************************************************
  * Name: file_fcntl
  *
@@ -1818,6 +1837,28 @@ int nx_unlink(FAR const char *pathname);
 int file_pipe(FAR struct file *filep[2], size_t bufsize, int flags);
 #endif
 
+/****************************************************************************
+ * Name: file_splice and file_tee
+ *
+ * Description:
+ *   Equivalent to the standard splice() and tee() functions except that
+ *   they accept struct file instances instead of file descriptors and they
+ *   do not set the errno variable.
+ *
+ * Returned Value:
+ *   The number of bytes transferred is returned on success; a negated
+ *   errno value is returned on a failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_PIPES
+ssize_t file_splice(FAR struct file *infile, FAR off_t *off_in,
+                    FAR struct file *outfile, FAR off_t *off_out,
+                    size_t len, unsigned int flags);
+ssize_t file_tee(FAR struct file *infile, FAR struct file *outfile,
+                 size_t len, unsigned int flags);
+#endif
+
 /****************************************************************************
  * Name: nx_mkfifo
  *
@@ -240,6 +240,12 @@ struct mod_loadinfo_s
                               * romfs/tmps, we can try get xipbase,
                               * skip the copy.
                               */
+#ifdef CONFIG_LIBC_ELF_XIP
+  uintptr_t     xipmap;      /* ET_REL - Memory mapped base of the file,
+                              * the unrelocated read-only sections are
+                              * used in place.
+                              */
+#endif
 
   /* Address environment.
    *
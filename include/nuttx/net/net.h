@@ -928,6 +928,55 @@ ssize_t psock_sendmsg(FAR struct socket *psock, FAR struct msghdr *msg,
 ssize_t psock_recvmsg(FAR struct socket *psock, FAR struct msghdr *msg,
                       int flags);
 
+/****************************************************************************
+ * Name: psock_sendmmsg
+ *
+ * Description:
+ *   psock_sendmmsg() sends several messages to a socket.  This is an
+ *   internal OS interface, functionally equivalent to sendmmsg() but not a
+ *   cancellation point and not modifying the errno variable.
+ *
+ * Input Parameters:
+ *   psock     A pointer to a NuttX-specific, internal socket structure
+ *   msgvec    The messages to send
+ *   vlen      The number of messages
+ *   flags     Send flags
+ *
+ * Returned Value:
+ *   The number of messages sent.  A negated errno value is returned if the
+ *   first message could not be sent.
+ *
+ ****************************************************************************/
+
+int psock_sendmmsg(FAR struct socket *psock, FAR struct mmsghdr *msgvec,
+                   unsigned int vlen, int flags);
+
+/****************************************************************************
+ * Name: psock_recvmmsg
+ *
+ * Description:
+ *   psock_recvmmsg() receives several messages from a socket.  This is an
+ *   internal OS interface, functionally equivalent to recvmmsg() but not a
+ *   cancellation point and not modifying the errno variable.
+ *
+ * Input Parameters:
+ *   psock     A pointer to a NuttX-specific, internal socket structure
+ *   msgvec    The buffers to receive the messages
+ *   vlen      The number of buffers
+ *   flags     Receive flags
+ *   timeout   Stop once this time has elapsed, checked after each
+ *             message.  NULL for no timeout.
+ *
+ * Returned Value:
+ *   The number of messages received.  A negated errno value is returned if
+ *   no message was received.
+ *
+ ****************************************************************************/
+
+int psock_recvmmsg(FAR struct socket *psock, FAR struct mmsghdr *msgvec,
+                   unsigned int vlen, int flags,
+                   FAR const struct timespec *timeout);
+
 /****************************************************************************
  * Name: psock_send
  *
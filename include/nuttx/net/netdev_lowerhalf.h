@@ -172,6 +172,27 @@ struct netdev_ops_s
   /* reclaim - try to reclaim packets sent by netdev. */
 
   CODE void (*reclaim)(FAR struct netdev_lowerhalf_s *dev);
+
+  /* transmit_batch - Optional, try to send several packets at once, with a
+   *                  single doorbell, non-blocking.  The packets are taken
+   *                  in order, each one owned as with transmit.
+   *   Returned Value:
+   *     The number of packets taken, from the first one, or a negated
+   *       errno value if none was.  Upper half then drops the first packet
+   *       and offers the others again.
+   */
+
+  CODE int (*transmit_batch)(FAR struct netdev_lowerhalf_s *dev,
+                             FAR netpkt_t **pkts, int npkts);
+
+  /* receive_batch - Optional, try to receive up to npkts packets at once,
+   *                 non-blocking.
+   *   Returned Value:
+   *     The number of packets stored in pkts, 0 if no more packets.
+   */
+
+  CODE int (*receive_batch)(FAR struct netdev_lowerhalf_s *dev,
+                            FAR netpkt_t **pkts, int npkts);
 };
 
 /* This structure is a set of wireless handlers, leave unsupported operations
@@ -54,6 +54,9 @@
  * NOTERAM_SETREADMODE
  *              - Set read mode
  *                Argument: A read-only pointer to unsigned int
+ * NOTERAM_GETSTATS
+ *              - Get the count of notes lost because the buffer was full
+ *                Argument: A writable pointer to struct noteram_stats_s
  */
 
 #ifdef CONFIG_DRIVERS_NOTERAM
@@ -62,6 +65,7 @@
 #define NOTERAM_SETMODE         _NOTERAMIOC(0x03)
 #define NOTERAM_GETREADMODE     _NOTERAMIOC(0x04)
 #define NOTERAM_SETREADMODE     _NOTERAMIOC(0x05)
+#define NOTERAM_GETSTATS        _NOTERAMIOC(0x06)
 #endif
 
 /* Overwrite mode definitions */
@@ -81,6 +85,14 @@
 
 struct noteram_driver_s;
 
+/* This is the type of the argument passed to the NOTERAM_GETSTATS ioctl */
+
+struct noteram_stats_s
+{
+  unsigned long ns_dropped;     /* Notes dropped in no-overwrite mode */
+  unsigned long ns_overwritten; /* Unread notes overwritten by newer ones */
+};
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -29,6 +29,8 @@
 
 #include <nuttx/config.h>
 
+#include <stdint.h>
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -57,6 +59,23 @@ struct symtab_s
   FAR const void *sym_value; /* The value associated with the string */
 };
 
+/* struct symtab_hash_s is a GNU-style hash index of a symbol table, as
+ * generated by tools/mksymtab -h.  The names hashing to bucket b are
+ * described by the chain entries buckets[b] through buckets[b + 1] - 1:
+ * chain[] holds their index in symtab[] and hashes[] their full hash, so
+ * that only names with an equal hash need to be compared.  nbuckets is a
+ * power of two.
+ */
+
+struct symtab_hash_s
+{
+  FAR const struct symtab_s *symtab;  /* The symbol table indexed */
+  FAR const uint16_t *buckets;        /* nbuckets + 1 chain offsets */
+  FAR const uint16_t *chain;          /* symtab[] index of each entry */
+  FAR const uint32_t *hashes;         /* Hash of each chain entry */
+  uint16_t nbuckets;                  /* Number of buckets */
+};
+
 /****************************************************************************
  * Public Functions Definitions
  ****************************************************************************/
@@ -89,6 +108,63 @@ FAR const struct symtab_s *
 symtab_findbyname(FAR const struct symtab_s *symtab,
                   FAR const char *name, int nsyms);
 
+#ifdef CONFIG_SYMTAB_HASHED
+
+/****************************************************************************
+ * Name: symtab_hashname
+ *
+ * Description:
+ *   Return the GNU hash (h = h * 33 + c, seeded with 5381) of a symbol name.
+ *
+ ****************************************************************************/
+
+uint32_t symtab_hashname(FAR const char *name);
+
+/****************************************************************************
+ * Name: symtab_findbyhash
+ *
+ * Description:
+ *   Find the symbol with the matching (undecorated) name using the hash
+ *   index of a symbol table.
+ *
+ * Returned Value:
+ *   A reference to the symbol table entry if an entry with the matching
+ *   name is found; NULL is returned if the entry is not found.
+ *
+ ****************************************************************************/
+
+FAR const struct symtab_s *
+symtab_findbyhash(FAR const struct symtab_hash_s *hash,
+                  FAR const char *name);
+
+/****************************************************************************
+ * Name: symtab_register_hash
+ *
+ * Description:
+ *   Register the hash index of a symbol table so that symtab_findbyname()
+ *   uses it for that table.  Registering the same index again is harmless.
+ *
+ * Returned Value:
+ *   Zero (OK) on success; -ENOSPC if CONFIG_SYMTAB_HASH_NTABLES indexes
+ *   are already registered.
+ *
+ ****************************************************************************/
+
+int symtab_register_hash(FAR const struct symtab_hash_s *hash);
+
+/****************************************************************************
+ * Name: symtab_gethash
+ *
+ * Description:
+ *   Return the registered hash index of a symbol table, or NULL.
+ *
+ ****************************************************************************/
+
+FAR const struct symtab_hash_s *
+symtab_gethash(FAR const struct symtab_s *symtab);
+
+#endif /* CONFIG_SYMTAB_HASHED */
+
 /****************************************************************************
  * Name: symtab_findbyvalue
  *
@@ -254,6 +254,9 @@ struct work_s
   clock_t          period; /* Periodical delay ticks */
   worker_t         worker; /* Work callback */
   FAR void        *arg;    /* Callback argument */
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+  FAR struct kwork_wqueue_s *wq; /* Per-CPU queue the work was added to */
+#endif
 };
 
 /* This is an enumeration of the various events that may be
@@ -66,9 +66,8 @@
 
 typedef struct
 {
-  dq_entry_t entry;
   Elf_Sym    sym;
-  int        idx;
+  int        idx;  /* Symbol table index, -1 if the slot is empty */
 } Elf_SymCache;
 
 struct
@@ -178,21 +177,19 @@ static inline int libelf_readrelas(FAR struct mod_loadinfo_s *loadinfo,
 
 static int libelf_relocate(FAR struct module_s *modp,
                            FAR struct mod_loadinfo_s *loadinfo, int relidx,
-                           FAR const struct symtab_s *exports, int nexports)
+                           FAR const struct symtab_s *exports, int nexports,
+                           FAR Elf_SymCache *cache, int ncache)
 {
   FAR Elf_Shdr     *relsec = &loadinfo->shdr[relidx];
   FAR Elf_Shdr     *dstsec = &loadinfo->shdr[relsec->sh_info];
   FAR Elf_Rel      *rels;
   FAR Elf_Rel      *rel;
-  FAR Elf_SymCache *cache;
+  FAR Elf_SymCache *slot;
   FAR Elf_Sym      *sym;
-  FAR dq_entry_t   *e;
-  dq_queue_t        q;
   uintptr_t         addr;
   int               symidx;
   int               ret = OK;
   int               i;
-  int               j;
 
   /* Define potential architecture specific elf data container */
 
@@ -206,14 +203,12 @@ static int libelf_relocate(FAR struct module_s *modp,
       return -ENOMEM;
     }
 
-  dq_init(&q);
-
   /* Examine each relocation in the section.  'relsec' is the section
    * containing the relations.  'dstsec' is the section containing the data
    * to be relocated.
    */
 
-  for (i = j = 0; i < relsec->sh_size / sizeof(Elf_Rel); i++)
+  for (i = 0; i < relsec->sh_size / sizeof(Elf_Rel); i++)
     {
       /* Read the relocation entry into memory */
 
@@ -238,45 +233,20 @@ static int libelf_relocate(FAR struct module_s *modp,
 
       symidx = ELF_R_SYM(rel->r_info);
 
-      /* First try the cache */
+      /* First try the cache.  It is direct-mapped by symbol index, so a
+       * miss simply replaces the symbol cached in the slot.
+       */
 
-      sym = NULL;
-      for (e = dq_peek(&q); e; e = dq_next(e))
-        {
-          cache = (FAR Elf_SymCache *)e;
-          if (cache->idx == symidx)
-            {
-              dq_rem(&cache->entry, &q);
-              dq_addfirst(&cache->entry, &q);
-              sym = &cache->sym;
-              break;
-            }
-        }
+      slot = &cache[symidx % ncache];
+      sym  = &slot->sym;
 
       /* If the symbol was not found in the cache, we will need to read the
        * symbol from the file.
        */
 
-      if (sym == NULL)
+      if (slot->idx != symidx)
         {
-          if (j < CONFIG_LIBC_ELF_SYMBOL_CACHECOUNT)
-            {
-              cache = lib_malloc(sizeof(Elf_SymCache));
-              if (!cache)
-                {
-                  berr("Failed to allocate memory for elf symbols\n");
-                  ret = -ENOMEM;
-                  break;
-                }
-
-              j++;
-            }
-          else
-            {
-              cache = (FAR Elf_SymCache *)dq_remlast(&q);
-            }
-
-          sym = &cache->sym;
+          slot->idx = -1;
 
           /* Read the symbol table entry into memory */
 
@@ -287,7 +257,6 @@ static int libelf_relocate(FAR struct module_s *modp,
               berr("ERROR: Section %d reloc %d: "
                    "Failed to read symbol[%d]: %d\n",
                    relidx, i, symidx, ret);
-              lib_free(cache);
               break;
             }
 
@@ -319,13 +288,11 @@ static int libelf_relocate(FAR struct module_s *modp,
                   berr("ERROR: Section %d reloc %d: "
                        "Failed to get value of symbol[%d]: %d\n",
                        relidx, i, symidx, ret);
-                  lib_free(cache);
                   break;
                 }
             }
 
-          cache->idx = symidx;
-          dq_addfirst(&cache->entry, &q);
+          slot->idx = symidx;
         }
 
       if (sym->st_shndx == SHN_UNDEF && sym->st_name == 0)
@@ -417,12 +384,6 @@ static int libelf_relocate(FAR struct module_s *modp,
     }
 
   lib_free(rels);
-  while ((e = dq_peek(&q)) != NULL)
-    {
-      dq_rem(e, &q);
-      lib_free(e);
-    }
-
   return ret;
 }
 
@@ -430,21 +391,19 @@ static int libelf_relocateadd(FAR struct module_s *modp,
                               FAR struct mod_loadinfo_s *loadinfo,
                               int relidx,
                               FAR const struct symtab_s *exports,
-                              int nexports)
+                              int nexports, FAR Elf_SymCache *cache,
+                              int ncache)
 {
   FAR Elf_Shdr     *relsec = &loadinfo->shdr[relidx];
   FAR Elf_Shdr     *dstsec = &loadinfo->shdr[relsec->sh_info];
   FAR Elf_Rela     *relas;
   FAR Elf_Rela     *rela;
-  FAR Elf_SymCache *cache;
+  FAR Elf_SymCache *slot;
   FAR Elf_Sym      *sym;
-  FAR dq_entry_t   *e;
-  dq_queue_t        q;
   uintptr_t         addr;
   int               symidx;
   int               ret = OK;
   int               i;
-  int               j;
 
   /* Define potential architecture specific elf data container */
 
@@ -458,14 +417,12 @@ static int libelf_relocateadd(FAR struct module_s *modp,
       return -ENOMEM;
     }
 
-  dq_init(&q);
-
   /* Examine each relocation in the section.  'relsec' is the section
    * containing the relations.  'dstsec' is the section containing the data
    * to be relocated.
    */
 
-  for (i = j = 0; i < relsec->sh_size / sizeof(Elf_Rela); i++)
+  for (i = 0; i < relsec->sh_size / sizeof(Elf_Rela); i++)
     {
       /* Read the relocation entry into memory */
 
@@ -490,45 +447,20 @@ static int libelf_relocateadd(FAR struct module_s *modp,
 
       symidx = ELF_R_SYM(rela->r_info);
 
-      /* First try the cache */
+      /* First try the cache.  It is direct-mapped by symbol index, so a
+       * miss simply replaces the symbol cached in the slot.
+       */
 
-      sym = NULL;
-      for (e = dq_peek(&q); e; e = dq_next(e))
-        {
-          cache = (FAR Elf_SymCache *)e;
-          if (cache->idx == symidx)
-            {
-              dq_rem(&cache->entry, &q);
-              dq_addfirst(&cache->entry, &q);
-              sym = &cache->sym;
-              break;
-            }
-        }
+      slot = &cache[symidx % ncache];
+      sym  = &slot->sym;
 
       /* If the symbol was not found in the cache, we will need to read the
        * symbol from the file.
        */
 
-      if (sym == NULL)
+      if (slot->idx != symidx)
         {
-          if (j < CONFIG_LIBC_ELF_SYMBOL_CACHECOUNT)
-            {
-              cache = lib_malloc(sizeof(Elf_SymCache));
-              if (!cache)
-                {
-                  berr("Failed to allocate memory for elf symbols\n");
-                  ret = -ENOMEM;
-                  break;
-                }
-
-              j++;
-            }
-          else
-            {
-              cache = (FAR Elf_SymCache *)dq_remlast(&q);
-            }
-
-          sym = &cache->sym;
+          slot->idx = -1;
 
           /* Read the symbol table entry into memory */
 
@@ -539,7 +471,6 @@ static int libelf_relocateadd(FAR struct module_s *modp,
               berr("ERROR: Section %d reloc %d: "
                    "Failed to read symbol[%d]: %d\n",
                    relidx, i, symidx, ret);
-              lib_free(cache);
               break;
             }
 
@@ -571,13 +502,11 @@ static int libelf_relocateadd(FAR struct module_s *modp,
                   berr("ERROR: Section %d reloc %d: "
                        "Failed to get value of symbol[%d]: %d\n",
                        relidx, i, symidx, ret);
-                  lib_free(cache);
                   break;
                 }
             }
 
-          cache->idx = symidx;
-          dq_addfirst(&cache->entry, &q);
+          slot->idx = symidx;
         }
 
       if (sym->st_shndx == SHN_UNDEF && sym->st_name == 0)
@@ -613,12 +542,6 @@ static int libelf_relocateadd(FAR struct module_s *modp,
     }
 
   lib_free(relas);
-  while ((e = dq_peek(&q)) != NULL)
-    {
-      dq_rem(e, &q);
-      lib_free(e);
-    }
-
   return ret;
 }
 
@@ -915,6 +838,8 @@ int libelf_bind(FAR struct module_s *modp,
                 FAR struct mod_loadinfo_s *loadinfo,
                 FAR const struct symtab_s *exports, int nexports)
 {
+  FAR Elf_SymCache *cache = NULL;
+  int ncache = 0;
   int ret;
   int i;
 
@@ -943,6 +868,37 @@ int libelf_bind(FAR struct module_s *modp,
       goto errout_with_addrenv;
     }
 
+  /* Allocate the symbol cache shared by all of the relocation sections.
+   * With no more symbols than slots, every symbol gets a slot of its own.
+   */
+
+  if (loadinfo->ehdr.e_type != ET_DYN)
+    {
+      ncache = loadinfo->shdr[loadinfo->symtabidx].sh_size /
+               sizeof(Elf_Sym);
+      if (ncache > CONFIG_LIBC_ELF_SYMBOL_CACHECOUNT)
+        {
+          ncache = CONFIG_LIBC_ELF_SYMBOL_CACHECOUNT;
+        }
+      else if (ncache < 1)
+        {
+          ncache = 1;
+        }
+
+      cache = lib_malloc(ncache * sizeof(Elf_SymCache));
+      if (cache == NULL)
+        {
+          berr("Failed to allocate memory for elf symbols\n");
+          ret = -ENOMEM;
+          goto errout_with_addrenv;
+        }
+
+      for (i = 0; i < ncache; i++)
+        {
+          cache[i].idx = -1;
+        }
+    }
+
   /* Process relocations in every allocated section */
 
   for (i = 1; i < loadinfo->ehdr.e_shnum; i++)
@@ -1018,7 +974,8 @@ int libelf_bind(FAR struct module_s *modp,
                     continue;
                   }
 
-                ret = libelf_relocate(modp, loadinfo, i, exports, nexports);
+                ret = libelf_relocate(modp, loadinfo, i, exports, nexports,
+                                      cache, ncache);
                 break;
               case SHT_RELA:
                 if ((loadinfo->shdr[infosec].sh_flags & SHF_ALLOC) == 0)
@@ -1027,7 +984,7 @@ int libelf_bind(FAR struct module_s *modp,
                   }
 
                 ret = libelf_relocateadd(modp, loadinfo, i, exports,
-                                         nexports);
+                                         nexports, cache, ncache);
                 break;
               case SHT_INIT_ARRAY:
                 loadinfo->initarr = loadinfo->shdr[i].sh_addr;
@@ -1079,6 +1036,10 @@ int libelf_bind(FAR struct module_s *modp,
 #endif
 
 errout_with_addrenv:
+  if (cache != NULL)
+    {
+      lib_free(cache);
+    }
 
 #ifdef CONFIG_ARCH_ADDRENV
   if (loadinfo->addrenv != NULL)
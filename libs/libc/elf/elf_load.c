@@ -33,6 +33,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/ioctl.h>
+#include <sys/statfs.h>
 #include <unistd.h>
 #include <assert.h>
 #include <errno.h>
@@ -140,6 +141,71 @@ static int libelf_section_alloc(FAR struct mod_loadinfo_s *loadinfo,
 }
 #endif
 
+/****************************************************************************
+ * Name: libelf_xipsection
+ *
+ * Description:
+ *   Return true if a section of a relocatable module can be used in place
+ *   in the memory mapped file: it holds read-only data, no relocation
+ *   applies to it and its address in the file is suitably aligned.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_LIBC_ELF_XIP
+static bool libelf_xipsection(FAR struct mod_loadinfo_s *loadinfo, int idx)
+{
+  FAR Elf_Shdr *shdr = &loadinfo->shdr[idx];
+  int i;
+
+  if (loadinfo->xipmap == 0 || shdr->sh_type == SHT_NOBITS ||
+      (shdr->sh_flags & (SHF_WRITE | SHF_EXECINSTR)) != 0)
+    {
+      return false;
+    }
+
+  if (shdr->sh_addralign > 1 &&
+      ((loadinfo->xipmap + shdr->sh_offset) &
+       (shdr->sh_addralign - 1)) != 0)
+    {
+      return false;
+    }
+
+  for (i = 0; i < loadinfo->ehdr.e_shnum; i++)
+    {
+      if ((loadinfo->shdr[i].sh_type == SHT_REL ||
+           loadinfo->shdr[i].sh_type == SHT_RELA) &&
+          loadinfo->shdr[i].sh_info == idx)
+        {
+          return false;
+        }
+    }
+
+  return true;
+}
+#else
+#  define libelf_xipsection(l, i) false
+#endif
+
+/****************************************************************************
+ * Name: libelf_xipimmutable
+ *
+ * Description:
+ *   Return true if the data of the file cannot move or change while the
+ *   module is loaded, so that its sections may be used in place.  tmpfs
+ *   also reports FIOC_XIPBASE, but its buffer is reallocated when the file
+ *   is written or truncated; only romfs qualifies.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_LIBC_ELF_XIP
+static bool libelf_xipimmutable(FAR struct mod_loadinfo_s *loadinfo)
+{
+  struct statfs buf;
+
+  return fstatfs(loadinfo->filfd, &buf) >= 0 && buf.f_type == ROMFS_MAGIC;
+}
+#endif
+
 /****************************************************************************
  * Name: libelf_elfsize
  *
@@ -195,6 +261,13 @@ static void libelf_elfsize(FAR struct mod_loadinfo_s *loadinfo, bool alloc)
 
           if ((shdr->sh_flags & SHF_ALLOC) != 0)
             {
+              /* Sections used in place need no memory */
+
+              if (libelf_xipsection(loadinfo, i))
+                {
+                  continue;
+                }
+
               /* SHF_WRITE indicates that the section address space is write-
                * able
                */
@@ -389,6 +462,22 @@ static inline int libelf_loadfile(FAR struct mod_loadinfo_s *loadinfo)
               continue;
             }
 
+#ifdef CONFIG_LIBC_ELF_XIP
+          if (libelf_xipsection(loadinfo, i))
+            {
+              uintptr_t addr = loadinfo->xipmap + shdr->sh_offset;
+
+              binfo("%d. %08lx->%08lx (in place)\n", i,
+                    (unsigned long)shdr->sh_addr, (unsigned long)addr);
+
+              /* Use offset to remember the original file address */
+
+              shdr->sh_offset = (uintptr_t)shdr->sh_addr;
+              shdr->sh_addr = addr;
+              continue;
+            }
+#endif
+
 #ifdef CONFIG_ARCH_USE_SEPARATED_SECTION
           if (loadinfo->ehdr.e_type == ET_REL ||
               loadinfo->ehdr.e_type == ET_EXEC)
@@ -568,6 +657,15 @@ int libelf_load(FAR struct mod_loadinfo_s *loadinfo)
           binfo("can use xipbase %zu\n", loadinfo->xipbase);
         }
     }
+#ifdef CONFIG_LIBC_ELF_XIP
+  else if (loadinfo->ehdr.e_type == ET_REL &&
+           libelf_xipimmutable(loadinfo) &&
+           ioctl(loadinfo->filfd, FIOC_XIPBASE,
+                 (unsigned long)&loadinfo->xipmap) >= 0)
+    {
+      binfo("can use xipmap %zu\n", loadinfo->xipmap);
+    }
+#endif
 
   /* Determine total size to allocate */
 
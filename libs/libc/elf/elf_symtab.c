@@ -49,6 +49,13 @@
 #  endif
 #endif
 
+/* The hash index generated along with the system symbol table */
+
+#if defined(CONFIG_LIBC_ELF_SYSTEM_SYMTAB) && defined(CONFIG_SYMTAB_HASHED)
+#  define SYMTAB_HASH(a)  SYMTAB_HASH_(a)
+#  define SYMTAB_HASH_(a) a##_hash
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -58,6 +65,10 @@ extern const struct symtab_s CONFIG_LIBC_ELF_SYMTAB_ARRAY[];
 extern int CONFIG_LIBC_ELF_NSYMBOLS_VAR;
 #endif
 
+#ifdef SYMTAB_HASH
+extern const struct symtab_hash_s SYMTAB_HASH(CONFIG_LIBC_ELF_SYMTAB_ARRAY);
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -97,6 +108,9 @@ void libelf_getsymtab(FAR const struct symtab_s **symtab, FAR int *nsymbols)
     {
       g_libelf_symtab = CONFIG_LIBC_ELF_SYMTAB_ARRAY;
       g_libelf_nsymbols = CONFIG_LIBC_ELF_NSYMBOLS_VAR;
+#ifdef SYMTAB_HASH
+      symtab_register_hash(&SYMTAB_HASH(CONFIG_LIBC_ELF_SYMTAB_ARRAY));
+#endif
     }
 #endif
 
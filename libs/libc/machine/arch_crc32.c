@@ -1,5 +1,5 @@
 /****************************************************************************
- * libs/libc/machine/arm/arch_crc32.c
+ * libs/libc/machine/arch_crc32.c
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -26,6 +26,24 @@
 
 #include <stdint.h>
 #include <sys/types.h>
+
+/* This file is built for ARM and ARM64.  On ARM64 the default
+ * -march=armv8-a does not include the CRC32 extension although every core
+ * selecting ARCH_HAVE_CRC32 implements it, so enable it for this file only.
+ */
+
+#if defined(__aarch64__) && !defined(__ARM_FEATURE_CRC32)
+#  ifdef __clang__
+#    define crc32_target __attribute__((target("crc")))
+#  else
+#    pragma GCC target("+crc")
+#  endif
+#endif
+
+#ifndef crc32_target
+#  define crc32_target
+#endif
+
 #include <arm_acle.h>
 
 /****************************************************************************
@@ -40,6 +58,7 @@
  *
  ****************************************************************************/
 
+crc32_target
 uint32_t crc32part(FAR const uint8_t *src, size_t len, uint32_t crc32val)
 {
   size_t i = 0;
@@ -81,6 +100,7 @@ uint32_t crc32part(FAR const uint8_t *src, size_t len, uint32_t crc32val)
  *
  ****************************************************************************/
 
+crc32_target
 uint32_t crc32part_c(FAR const uint8_t *src, size_t len, uint32_t crc32val)
 {
   size_t i = 0;
@@ -26,10 +26,24 @@
 
 #include <nuttx/config.h>
 
+#include <stdint.h>
 #include <string.h>
 
 #include "libc.h"
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define LBLOCKSIZE   (sizeof(uintptr_t))
+#define LBLOCKMASK   (LBLOCKSIZE - 1)
+
+/* Nonzero if the word x contains a NUL byte */
+
+#define LBLOCKONES   ((uintptr_t)-1 / 0xff)
+#define LBLOCKHIGHS  (LBLOCKONES << 7)
+#define DETECTNULL(x) (((x) - LBLOCKONES) & ~(x) & LBLOCKHIGHS)
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -54,6 +68,38 @@ FAR void *memchr(FAR const void *s, int c, size_t n)
 {
   FAR const unsigned char *p = (FAR const unsigned char *)s;
 
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+  /* Search a word at a time once aligned, a word holding the byte has a
+   * NUL byte once XORed with the byte repeated.
+   */
+
+  if (n >= 2 * LBLOCKSIZE)
+    {
+      FAR const uintptr_t *w;
+      uintptr_t mask = LBLOCKONES * (unsigned char)c;
+
+      while (((uintptr_t)p & LBLOCKMASK) != 0)
+        {
+          if (*p == (unsigned char)c)
+            {
+              return (FAR void *)p;
+            }
+
+          p++;
+          n--;
+        }
+
+      w = (FAR const uintptr_t *)p;
+      while (n >= LBLOCKSIZE && !DETECTNULL(*w ^ mask))
+        {
+          w++;
+          n -= LBLOCKSIZE;
+        }
+
+      p = (FAR const unsigned char *)w;
+    }
+#endif
+
   while (n--)
     {
       if (*p == (unsigned char)c)
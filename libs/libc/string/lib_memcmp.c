@@ -26,10 +26,18 @@
 
 #include <nuttx/config.h>
 #include <sys/types.h>
+#include <stdint.h>
 #include <string.h>
 
 #include "libc.h"
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define LBLOCKSIZE   (sizeof(uintptr_t))
+#define LBLOCKMASK   (LBLOCKSIZE - 1)
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -42,6 +50,43 @@ int memcmp(FAR const void *s1, FAR const void *s2, size_t n)
   FAR unsigned char *p1 = (FAR unsigned char *)s1;
   FAR unsigned char *p2 = (FAR unsigned char *)s2;
 
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+  /* Skip the equal words if both buffers can be aligned, the bytes of the
+   * first different word are compared below.
+   */
+
+  if (n >= 2 * LBLOCKSIZE &&
+      (((uintptr_t)p1 ^ (uintptr_t)p2) & LBLOCKMASK) == 0)
+    {
+      FAR const uintptr_t *w1;
+      FAR const uintptr_t *w2;
+
+      while (((uintptr_t)p1 & LBLOCKMASK) != 0)
+        {
+          if (*p1 != *p2)
+            {
+              return *p1 < *p2 ? -1 : 1;
+            }
+
+          p1++;
+          p2++;
+          n--;
+        }
+
+      w1 = (FAR const uintptr_t *)p1;
+      w2 = (FAR const uintptr_t *)p2;
+      while (n >= LBLOCKSIZE && *w1 == *w2)
+        {
+          w1++;
+          w2++;
+          n -= LBLOCKSIZE;
+        }
+
+      p1 = (FAR unsigned char *)w1;
+      p2 = (FAR unsigned char *)w2;
+    }
+#endif
+
   while (n-- > 0)
     {
       if (*p1 < *p2)
@@ -26,10 +26,31 @@
 
 #include <nuttx/config.h>
 #include <sys/types.h>
+#include <stdint.h>
 #include <string.h>
 
 #include "libc.h"
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define LBLOCKSIZE   (sizeof(uintptr_t))
+#define LBLOCKMASK   (LBLOCKSIZE - 1)
+#define LBLOCKBITS   (LBLOCKSIZE * 8)
+
+/* Build a word of the destination from two aligned words of the source,
+ * the first one holding the bytes of the source after 'shift' bits.
+ */
+
+#ifdef CONFIG_ENDIAN_BIG
+#  define MERGE(w0, w1, shift) \
+     (((w0) << (shift)) | ((w1) >> (LBLOCKBITS - (shift))))
+#else
+#  define MERGE(w0, w1, shift) \
+     (((w0) >> (shift)) | ((w1) << (LBLOCKBITS - (shift))))
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -41,10 +62,74 @@
 #if !defined(CONFIG_LIBC_ARCH_MEMCPY) && defined(LIBC_BUILD_MEMCPY)
 #undef memcpy /* See mm/README.txt */
 no_builtin("memcpy")
+nosanitize_address
 FAR void *memcpy(FAR void *dest, FAR const void *src, size_t n)
 {
   FAR unsigned char *pout = (FAR unsigned char *)dest;
   FAR unsigned char *pin  = (FAR unsigned char *)src;
+
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+  /* Copy a word at a time once the destination is aligned.  If the source
+   * is not aligned the same way, each word of the destination is merged
+   * from two aligned words of the source, which never reads outside of
+   * the words holding the source bytes.
+   */
+
+  if (n >= 2 * LBLOCKSIZE)
+    {
+      FAR uintptr_t *wout;
+      FAR const uintptr_t *win;
+      unsigned int shift;
+      uintptr_t prev;
+      uintptr_t next;
+
+      while (((uintptr_t)pout & LBLOCKMASK) != 0)
+        {
+          *pout++ = *pin++;
+          n--;
+        }
+
+      wout  = (FAR uintptr_t *)pout;
+      shift = ((uintptr_t)pin & LBLOCKMASK) * 8;
+
+      if (shift == 0)
+        {
+          win = (FAR const uintptr_t *)pin;
+          while (n >= 4 * LBLOCKSIZE)
+            {
+              wout[0] = win[0];
+              wout[1] = win[1];
+              wout[2] = win[2];
+              wout[3] = win[3];
+              wout   += 4;
+              win    += 4;
+              n      -= 4 * LBLOCKSIZE;
+            }
+
+          while (n >= LBLOCKSIZE)
+            {
+              *wout++ = *win++;
+              n      -= LBLOCKSIZE;
+            }
+        }
+      else
+        {
+          win  = (FAR const uintptr_t *)((uintptr_t)pin & ~LBLOCKMASK);
+          prev = *win++;
+          while (n >= LBLOCKSIZE)
+            {
+              next    = *win++;
+              *wout++ = MERGE(prev, next, shift);
+              prev    = next;
+              n      -= LBLOCKSIZE;
+            }
+        }
+
+      pin += (FAR unsigned char *)wout - pout;
+      pout = (FAR unsigned char *)wout;
+    }
+#endif
+
   while (n-- > 0)
     {
       *pout++ = *pin++;
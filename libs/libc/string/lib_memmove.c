@@ -26,10 +26,18 @@
 
 #include <nuttx/config.h>
 #include <sys/types.h>
+#include <stdint.h>
 #include <string.h>
 
 #include "libc.h"
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define LBLOCKSIZE   (sizeof(uintptr_t))
+#define LBLOCKMASK   (LBLOCKSIZE - 1)
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -51,6 +59,34 @@ FAR void *memmove(FAR void *dest, FAR const void *src, size_t count)
       tmp = (FAR char *) dest + count;
       s   = (FAR char *) src + count;
 
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+      /* Copy backward a word at a time if both ends can be aligned */
+
+      if (count >= 2 * LBLOCKSIZE &&
+          (((uintptr_t)tmp ^ (uintptr_t)s) & LBLOCKMASK) == 0)
+        {
+          FAR uintptr_t *wout;
+          FAR const uintptr_t *win;
+
+          while (((uintptr_t)tmp & LBLOCKMASK) != 0)
+            {
+              *--tmp = *--s;
+              count--;
+            }
+
+          wout = (FAR uintptr_t *)tmp;
+          win  = (FAR const uintptr_t *)s;
+          while (count >= LBLOCKSIZE)
+            {
+              *--wout = *--win;
+              count  -= LBLOCKSIZE;
+            }
+
+          tmp = (FAR char *)wout;
+          s   = (FAR char *)win;
+        }
+#endif
+
       while (count--)
         {
           *--tmp = *--s;
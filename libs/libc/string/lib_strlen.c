@@ -26,20 +26,57 @@
 
 #include <nuttx/config.h>
 #include <sys/types.h>
+#include <stdint.h>
 #include <string.h>
 
 #include "libc.h"
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define LBLOCKSIZE   (sizeof(uintptr_t))
+#define LBLOCKMASK   (LBLOCKSIZE - 1)
+
+/* Nonzero if the word x contains a NUL byte */
+
+#define LBLOCKONES   ((uintptr_t)-1 / 0xff)
+#define LBLOCKHIGHS  (LBLOCKONES << 7)
+#define DETECTNULL(x) (((x) - LBLOCKONES) & ~(x) & LBLOCKHIGHS)
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
 
 #if !defined(CONFIG_LIBC_ARCH_STRLEN) && defined(LIBC_BUILD_STRLEN)
 #undef strlen /* See mm/README.txt */
+nosanitize_address
 size_t strlen(FAR const char *s)
 {
   FAR const char *sc;
-  for (sc = s; *sc != '\0'; ++sc);
+
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+  FAR const uintptr_t *w;
+
+  /* Once aligned, look for the word holding the NUL.  An aligned word
+   * never crosses a page, so reading past the NUL is harmless.
+   */
+
+  for (sc = s; ((uintptr_t)sc & LBLOCKMASK) != 0; ++sc)
+    {
+      if (*sc == '\0')
+        {
+          return sc - s;
+        }
+    }
+
+  for (w = (FAR const uintptr_t *)sc; !DETECTNULL(*w); ++w);
+  sc = (FAR const char *)w;
+#else
+  sc = s;
+#endif
+
+  for (; *sc != '\0'; ++sc);
   return sc - s;
 }
 #endif
@@ -55,6 +55,9 @@ FAR const struct symtab_s *
 symtab_findbyname(FAR const struct symtab_s *symtab,
                   FAR const char *name, int nsyms)
 {
+#ifdef CONFIG_SYMTAB_HASHED
+  FAR const struct symtab_hash_s *hash;
+#endif
 #ifdef CONFIG_SYMTAB_ORDEREDBYNAME
   int low  = 0;
   int high = nsyms - 1;
@@ -77,6 +80,16 @@ symtab_findbyname(FAR const struct symtab_s *symtab,
 
   DEBUGASSERT(name != NULL);
 
+#ifdef CONFIG_SYMTAB_HASHED
+  /* Use the hash index of the table if one was registered */
+
+  hash = symtab_gethash(symtab);
+  if (hash != NULL)
+    {
+      return symtab_findbyhash(hash, name);
+    }
+#endif
+
 #ifdef CONFIG_SYMTAB_ORDEREDBYNAME
   while (low < high)
     {
@@ -0,0 +1,183 @@
+/****************************************************************************
+ * libs/libc/symtab/symtab_hash.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <string.h>
+#include <assert.h>
+#include <errno.h>
+
+#include <nuttx/spinlock.h>
+#include <nuttx/symtab.h>
+
+#ifdef CONFIG_SYMTAB_HASHED
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The registered hash indexes.  They are generated constant data, so an
+ * entry is never removed once set and symtab_gethash() needs no lock.
+ */
+
+static FAR const struct symtab_hash_s *
+g_symtab_hash[CONFIG_SYMTAB_HASH_NTABLES];
+static spinlock_t g_symtab_hash_lock = SP_UNLOCKED;
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: symtab_hashname
+ *
+ * Description:
+ *   Return the GNU hash (h = h * 33 + c, seeded with 5381) of a symbol name.
+ *   tools/mksymtab.c computes the same hash at build time.
+ *
+ ****************************************************************************/
+
+uint32_t symtab_hashname(FAR const char *name)
+{
+  uint32_t hash = 5381;
+
+  while (*name != '\0')
+    {
+      hash = (hash << 5) + hash + (uint8_t)*name++;
+    }
+
+  return hash;
+}
+
+/****************************************************************************
+ * Name: symtab_findbyhash
+ *
+ * Description:
+ *   Find the symbol with the matching (undecorated) name using the hash
+ *   index of a symbol table.
+ *
+ * Returned Value:
+ *   A reference to the symbol table entry if an entry with the matching
+ *   name is found; NULL is returned if the entry is not found.
+ *
+ ****************************************************************************/
+
+FAR const struct symtab_s *
+symtab_findbyhash(FAR const struct symtab_hash_s *hash,
+                  FAR const char *name)
+{
+  FAR const struct symtab_s *symbol;
+  uint32_t value;
+  int bucket;
+  int i;
+
+  DEBUGASSERT(hash != NULL && name != NULL);
+
+  value  = symtab_hashname(name);
+  bucket = value & (hash->nbuckets - 1);
+
+  for (i = hash->buckets[bucket]; i < hash->buckets[bucket + 1]; i++)
+    {
+      if (hash->hashes[i] == value)
+        {
+          symbol = &hash->symtab[hash->chain[i]];
+          if (strcmp(name, symbol->sym_name) == 0)
+            {
+              return symbol;
+            }
+        }
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: symtab_register_hash
+ *
+ * Description:
+ *   Register the hash index of a symbol table so that symtab_findbyname()
+ *   uses it for that table.  Registering the same index again is harmless.
+ *
+ * Returned Value:
+ *   Zero (OK) on success; -ENOSPC if CONFIG_SYMTAB_HASH_NTABLES indexes
+ *   are already registered.
+ *
+ ****************************************************************************/
+
+int symtab_register_hash(FAR const struct symtab_hash_s *hash)
+{
+  irqstate_t flags;
+  int ret = -ENOSPC;
+  int i;
+
+  DEBUGASSERT(hash != NULL && hash->nbuckets > 0 &&
+              (hash->nbuckets & (hash->nbuckets - 1)) == 0);
+
+  flags = spin_lock_irqsave(&g_symtab_hash_lock);
+  for (i = 0; i < CONFIG_SYMTAB_HASH_NTABLES; i++)
+    {
+      if (g_symtab_hash[i] == hash)
+        {
+          ret = OK;
+          break;
+        }
+      else if (g_symtab_hash[i] == NULL)
+        {
+          g_symtab_hash[i] = hash;
+          ret = OK;
+          break;
+        }
+    }
+
+  spin_unlock_irqrestore(&g_symtab_hash_lock, flags);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: symtab_gethash
+ *
+ * Description:
+ *   Return the registered hash index of a symbol table, or NULL.
+ *
+ ****************************************************************************/
+
+FAR const struct symtab_hash_s *
+symtab_gethash(FAR const struct symtab_s *symtab)
+{
+  int i;
+
+  for (i = 0; i < CONFIG_SYMTAB_HASH_NTABLES && g_symtab_hash[i]; i++)
+    {
+      if (g_symtab_hash[i]->symtab == symtab)
+        {
+          return g_symtab_hash[i];
+        }
+    }
+
+  return NULL;
+}
+
+#endif /* CONFIG_SYMTAB_HASHED */
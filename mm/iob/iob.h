@@ -137,6 +137,64 @@ FAR struct iob_qentry_s *iob_tryalloc_qentry(void);
 
 FAR struct iob_qentry_s *iob_free_qentry(FAR struct iob_qentry_s *iobq);
 
+/****************************************************************************
+ * Name: iob_release
+ *
+ * Description:
+ *   Return a list of I/O buffers linked by io_flink to the free list, or
+ *   hand them over to the tasks waiting for an IOB.
+ *
+ ****************************************************************************/
+
+void iob_release(FAR struct iob_s *iob);
+
+#ifdef CONFIG_IOB_PERCPU_CACHE
+
+/****************************************************************************
+ * Name: iob_cache_alloc
+ *
+ * Description:
+ *   Take a non-throttled I/O buffer from the cache of this CPU, refilling
+ *   it from the free list if needed, or from the cache of another CPU if
+ *   the free list is empty.  Return NULL if no buffer is free.
+ *
+ ****************************************************************************/
+
+FAR struct iob_s *iob_cache_alloc(void);
+
+/****************************************************************************
+ * Name: iob_cache_free
+ *
+ * Description:
+ *   Put a freed I/O buffer in the cache of this CPU.  Return the list of
+ *   the buffers that must be returned with iob_release(), or NULL.
+ *
+ ****************************************************************************/
+
+FAR struct iob_s *iob_cache_free(FAR struct iob_s *iob);
+
+/****************************************************************************
+ * Name: iob_cache_flush
+ *
+ * Description:
+ *   Return the I/O buffers cached by all CPUs.
+ *
+ ****************************************************************************/
+
+void iob_cache_flush(void);
+
+/****************************************************************************
+ * Name: iob_cache_count
+ *
+ * Description:
+ *   Return the number of I/O buffers cached by all CPUs.
+ *
+ ****************************************************************************/
+
+int iob_cache_count(void);
+
+#endif /* CONFIG_IOB_PERCPU_CACHE */
+
 /****************************************************************************
  * Name: iob_notifier_signal
  *
@@ -173,6 +173,17 @@ static FAR struct iob_s *iob_allocwait(bool throttled, unsigned int timeout)
    * we are waiting for I/O buffers to become free.
    */
 
+#ifdef CONFIG_IOB_PERCPU_CACHE
+  if (!throttled)
+    {
+      iob = iob_cache_alloc();
+      if (iob != NULL)
+        {
+          return iob;
+        }
+    }
+#endif
+
   flags = spin_lock_irqsave(&g_iob_lock);
 
   /* Try to get an I/O buffer */
@@ -193,6 +204,12 @@ static FAR struct iob_s *iob_allocwait(bool throttled, unsigned int timeout)
 
       spin_unlock_irqrestore(&g_iob_lock, flags);
 
+#ifdef CONFIG_IOB_PERCPU_CACHE
+      /* The buffers cached by the CPUs are handed over to the waiters */
+
+      iob_cache_flush();
+#endif
+
       if (timeout == UINT_MAX)
         {
           ret = nxsem_wait_uninterruptible(sem);
@@ -300,6 +317,13 @@ FAR struct iob_s *iob_tryalloc(bool throttled)
   FAR struct iob_s *iob;
   irqstate_t flags;
 
+#ifdef CONFIG_IOB_PERCPU_CACHE
+  if (!throttled)
+    {
+      return iob_cache_alloc();
+    }
+#endif
+
   /* We don't know what context we are called from so we use extreme measures
    * to protect the free list:  We disable interrupts very briefly.
    */
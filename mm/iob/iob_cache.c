@@ -0,0 +1,295 @@
+/****************************************************************************
+ * mm/iob/iob_cache.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <assert.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/sched.h>
+#include <nuttx/spinlock.h>
+#include <nuttx/mm/iob.h>
+
+#include "iob.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Number of IOBs moved between a cache and the free list at once */
+
+#define IOB_CACHE_BATCH  ((CONFIG_IOB_PERCPU_CACHE_DEPTH + 1) / 2)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* The IOBs cached by one CPU.  The lock is normally only taken by that CPU,
+ * the other CPUs take it to flush the cache when an IOB is waited for, or
+ * to take an IOB when the free list is empty.  It is always taken before
+ * g_iob_lock, and no two cache locks are held together.
+ */
+
+struct iob_cache_s
+{
+  spinlock_t ic_lock;
+  FAR struct iob_s *ic_list;
+  int16_t ic_count;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct iob_cache_s g_iob_cache[CONFIG_SMP_NCPUS];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: iob_cache_take
+ *
+ * Description:
+ *   Remove the I/O buffer at the head of a cache, or return NULL if the
+ *   cache is empty.  The lock of the cache is held.
+ *
+ ****************************************************************************/
+
+static FAR struct iob_s *iob_cache_take(FAR struct iob_cache_s *cache)
+{
+  FAR struct iob_s *iob = cache->ic_list;
+
+  if (iob != NULL)
+    {
+      cache->ic_list = iob->io_flink;
+      cache->ic_count--;
+    }
+
+  return iob;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: iob_cache_alloc
+ *
+ * Description:
+ *   Take an I/O buffer from the cache of this CPU.  An empty cache is
+ *   refilled with a batch of buffers from the free list, under a single
+ *   hold of g_iob_lock.  If the free list is empty too, a buffer is taken
+ *   from the cache of another CPU.  Return NULL if no buffer is free.
+ *
+ *   Only the non-throttled allocations are served from the caches.
+ *
+ ****************************************************************************/
+
+FAR struct iob_s *iob_cache_alloc(void)
+{
+  FAR struct iob_cache_s *cache;
+  FAR struct iob_s *iob;
+  irqstate_t flags;
+  int n;
+
+  flags = up_irq_save();
+  cache = &g_iob_cache[this_cpu()];
+  spin_lock(&cache->ic_lock);
+
+  if (cache->ic_list == NULL)
+    {
+      /* Take a batch, but not more than half of the free buffers so that
+       * the other CPUs are not starved.
+       */
+
+      spin_lock(&g_iob_lock);
+      for (n = 0; n < IOB_CACHE_BATCH && n < (g_iob_count + 1) / 2; n++)
+        {
+          iob = g_iob_freelist;
+          if (iob == NULL)
+            {
+              break;
+            }
+
+          g_iob_freelist  = iob->io_flink;
+          g_iob_count--;
+
+          iob->io_flink   = cache->ic_list;
+          cache->ic_list  = iob;
+          cache->ic_count++;
+        }
+
+      spin_unlock(&g_iob_lock);
+    }
+
+  iob = iob_cache_take(cache);
+  spin_unlock(&cache->ic_lock);
+
+  /* The free list is empty too.  Take a buffer cached by another CPU, as
+   * iob_navail() counts them as available.  The lock of this cache is
+   * released first since two cache locks are never held together.
+   */
+
+  for (n = 0; iob == NULL && n < CONFIG_SMP_NCPUS; n++)
+    {
+      if (&g_iob_cache[n] != cache)
+        {
+          spin_lock(&g_iob_cache[n].ic_lock);
+          iob = iob_cache_take(&g_iob_cache[n]);
+          spin_unlock(&g_iob_cache[n].ic_lock);
+        }
+    }
+
+  up_irq_restore(flags);
+
+  if (iob != NULL)
+    {
+      /* Put the I/O buffer in a known state */
+
+      iob->io_flink  = NULL; /* Not in a chain */
+      iob->io_len    = 0;    /* Length of the data in the entry */
+      iob->io_offset = 0;    /* Offset to the beginning of data */
+      iob->io_pktlen = 0;    /* Total length of the packet */
+    }
+
+  return iob;
+}
+
+/****************************************************************************
+ * Name: iob_cache_free
+ *
+ * Description:
+ *   Put a freed I/O buffer in the cache of this CPU.  Half of a full cache
+ *   is drained.  Nothing is cached while a task waits for an IOB.
+ *
+ * Returned Value:
+ *   The list of the buffers that must be returned with iob_release(), or
+ *   NULL if there is none.
+ *
+ ****************************************************************************/
+
+FAR struct iob_s *iob_cache_free(FAR struct iob_s *iob)
+{
+  FAR struct iob_cache_s *cache;
+  FAR struct iob_s *drain = NULL;
+  FAR struct iob_s *tail;
+  irqstate_t flags;
+  int n;
+
+  flags = up_irq_save();
+  cache = &g_iob_cache[this_cpu()];
+  spin_lock(&cache->ic_lock);
+
+  /* A waiter counts itself before flushing the caches, so this check is
+   * made under the lock of the cache.
+   */
+
+#if CONFIG_IOB_THROTTLE > 0
+  if (g_iob_count < 0 || g_throttle_wait > 0)
+#else
+  if (g_iob_count < 0)
+#endif
+    {
+      iob->io_flink = NULL;
+      drain         = iob;
+    }
+  else
+    {
+      iob->io_flink  = cache->ic_list;
+      cache->ic_list = iob;
+      if (++cache->ic_count > CONFIG_IOB_PERCPU_CACHE_DEPTH)
+        {
+          drain = cache->ic_list;
+          for (tail = drain, n = 1; n < IOB_CACHE_BATCH; n++)
+            {
+              tail = tail->io_flink;
+            }
+
+          cache->ic_list   = tail->io_flink;
+          cache->ic_count -= IOB_CACHE_BATCH;
+          tail->io_flink   = NULL;
+        }
+    }
+
+  spin_unlock(&cache->ic_lock);
+  up_irq_restore(flags);
+  return drain;
+}
+
+/****************************************************************************
+ * Name: iob_cache_flush
+ *
+ * Description:
+ *   Return the I/O buffers cached by all CPUs.  This is called by a task
+ *   about to wait for an IOB, after it counted itself as a waiter.
+ *
+ ****************************************************************************/
+
+void iob_cache_flush(void)
+{
+  FAR struct iob_cache_s *cache;
+  FAR struct iob_s *drain;
+  irqstate_t flags;
+  int cpu;
+
+  for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      cache = &g_iob_cache[cpu];
+
+      flags           = spin_lock_irqsave(&cache->ic_lock);
+      drain           = cache->ic_list;
+      cache->ic_list  = NULL;
+      cache->ic_count = 0;
+      spin_unlock_irqrestore(&cache->ic_lock, flags);
+
+      if (drain != NULL)
+        {
+          iob_release(drain);
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: iob_cache_count
+ *
+ * Description:
+ *   Return the number of I/O buffers cached by all CPUs.
+ *
+ ****************************************************************************/
+
+int iob_cache_count(void)
+{
+  int count = 0;
+  int cpu;
+
+  for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      count += g_iob_cache[cpu].ic_count;
+    }
+
+  return count;
+}
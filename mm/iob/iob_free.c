@@ -67,6 +67,86 @@
  * Public Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: iob_release
+ *
+ * Description:
+ *   Return a list of I/O buffers linked by io_flink to the free list, or
+ *   hand them over to the tasks waiting for an IOB.
+ *
+ ****************************************************************************/
+
+void iob_release(FAR struct iob_s *iob)
+{
+  FAR struct iob_s *next;
+  irqstate_t flags;
+
+  while (iob != NULL)
+    {
+      next = iob->io_flink;
+
+      /* Free the I/O buffer by adding it to the head of the free or the
+       * committed list. We don't know what context we are called from so
+       * we use extreme measures to protect the free list:  We disable
+       * interrupts very briefly.
+       */
+
+      flags = spin_lock_irqsave(&g_iob_lock);
+
+      /* Which list?  If there is a task waiting for an IOB, then put
+       * the IOB on either the free list or on the committed list where
+       * it is reserved for that allocation (and not available to
+       * iob_tryalloc()). This is true for both throttled and non-throttled
+       * cases.
+       */
+
+      if (g_iob_count < 0)
+        {
+          g_iob_count++;
+          iob->io_flink   = g_iob_committed;
+          g_iob_committed = iob;
+          spin_unlock_irqrestore(&g_iob_lock, flags);
+          nxsem_post(&g_iob_sem);
+        }
+#if CONFIG_IOB_THROTTLE > 0
+      else if (g_throttle_wait > 0 && g_iob_count >= CONFIG_IOB_THROTTLE)
+        {
+          iob->io_flink   = g_iob_committed;
+          g_iob_committed = iob;
+          g_throttle_wait--;
+          spin_unlock_irqrestore(&g_iob_lock, flags);
+          nxsem_post(&g_throttle_sem);
+        }
+#endif
+      else
+        {
+          /* Nobody waits, the rest of the list goes to the free list
+           * under the same hold of the lock.
+           */
+
+          for (; ; )
+            {
+              g_iob_count++;
+              iob->io_flink  = g_iob_freelist;
+              g_iob_freelist = iob;
+
+              iob = next;
+              if (iob == NULL)
+                {
+                  break;
+                }
+
+              next = iob->io_flink;
+            }
+
+          spin_unlock_irqrestore(&g_iob_lock, flags);
+        }
+
+      DEBUGASSERT(g_iob_count <= CONFIG_IOB_NBUFFERS);
+      iob = next;
+    }
+}
+
 /****************************************************************************
  * Name: iob_free
  *
@@ -79,7 +159,6 @@
 FAR struct iob_s *iob_free(FAR struct iob_s *iob)
 {
   FAR struct iob_s *next = iob->io_flink;
-  irqstate_t flags;
 #ifdef CONFIG_IOB_NOTIFIER
   int16_t navail;
 #endif
@@ -126,48 +205,18 @@ FAR struct iob_s *iob_free(FAR struct iob_s *iob)
     }
 #endif
 
-  /* Free the I/O buffer by adding it to the head of the free or the
-   * committed list. We don't know what context we are called from so
-   * we use extreme measures to protect the free list:  We disable
-   * interrupts very briefly.
-   */
-
-  flags = spin_lock_irqsave(&g_iob_lock);
+#ifdef CONFIG_IOB_PERCPU_CACHE
+  /* Keep the I/O buffer in the cache of this CPU if possible */
 
-  /* Which list?  If there is a task waiting for an IOB, then put
-   * the IOB on either the free list or on the committed list where
-   * it is reserved for that allocation (and not available to
-   * iob_tryalloc()). This is true for both throttled and non-throttled
-   * cases.
-   */
-
-  if (g_iob_count < 0)
+  iob = iob_cache_free(iob);
+  if (iob != NULL)
     {
-      g_iob_count++;
-      iob->io_flink   = g_iob_committed;
-      g_iob_committed = iob;
-      spin_unlock_irqrestore(&g_iob_lock, flags);
-      nxsem_post(&g_iob_sem);
-    }
-#if CONFIG_IOB_THROTTLE > 0
-  else if (g_throttle_wait > 0 && g_iob_count >= CONFIG_IOB_THROTTLE)
-    {
-      iob->io_flink   = g_iob_committed;
-      g_iob_committed = iob;
-      g_throttle_wait--;
-      spin_unlock_irqrestore(&g_iob_lock, flags);
-      nxsem_post(&g_throttle_sem);
+      iob_release(iob);
     }
+#else
+  iob->io_flink = NULL;
+  iob_release(iob);
 #endif
-  else
-    {
-      g_iob_count++;
-      iob->io_flink   = g_iob_freelist;
-      g_iob_freelist  = iob;
-      spin_unlock_irqrestore(&g_iob_lock, flags);
-    }
-
-  DEBUGASSERT(g_iob_count <= CONFIG_IOB_NBUFFERS);
 
 #ifdef CONFIG_IOB_NOTIFIER
   /* Check if the IOB was claimed by a thread that is blocked waiting
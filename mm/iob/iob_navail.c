@@ -60,6 +60,15 @@ int iob_navail(bool throttled)
     }
 #endif
 
+#ifdef CONFIG_IOB_PERCPU_CACHE
+  /* The cached buffers are only available to non-throttled allocations */
+
+  if (!throttled && ret >= 0)
+    {
+      ret += iob_cache_count();
+    }
+#endif
+
   if (ret < 0)
     {
       ret = 0;
@@ -65,6 +65,9 @@ void iob_getstats(FAR struct iob_stats_s *stats)
   else
     {
       stats->nwait = 0;
+#ifdef CONFIG_IOB_PERCPU_CACHE
+      stats->nfree += iob_cache_count();
+#endif
     }
 
 #if CONFIG_IOB_THROTTLE > 0
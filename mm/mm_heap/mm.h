@@ -30,6 +30,7 @@
 #include <nuttx/config.h>
 
 #include <nuttx/mutex.h>
+#include <nuttx/spinlock_type.h>
 #include <nuttx/sched.h>
 #include <nuttx/fs/procfs.h>
 #include <nuttx/lib/math32.h>
@@ -157,6 +158,20 @@
 #define MM_PREVNODE_IS_ALLOC(node) (((node)->size & MM_PREVFREE_BIT) == 0)
 #define MM_PREVNODE_IS_FREE(node) (((node)->size & MM_PREVFREE_BIT) != 0)
 
+/* The per-CPU chunk cache keeps one list per chunk size, from MM_MIN_CHUNK
+ * up to CONFIG_MM_HEAP_PERCPU_CACHE_MAXSIZE in steps of MM_ALIGN.  It is
+ * only used where interrupts can be disabled to own this CPU's lists.
+ */
+
+#ifdef CONFIG_MM_HEAP_PERCPU_CACHE
+#  define MM_CACHE_NCLASSES \
+     ((CONFIG_MM_HEAP_PERCPU_CACHE_MAXSIZE - MM_MIN_CHUNK) / MM_ALIGN + 1)
+#  define MM_CACHE_CLASS(size)  (((size) - MM_MIN_CHUNK) / MM_ALIGN)
+#  if defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__)
+#    define MM_CACHE_ENABLED 1
+#  endif
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -213,6 +228,23 @@ struct mm_delaynode_s
   FAR struct mm_delaynode_s *flink;
 };
 
+/* This describes the chunk cache of one CPU.  The cached chunks are still
+ * allocated from the heap's point of view, they are linked through their
+ * payload like the delay list.  The lock is only contended when another
+ * CPU flushes the cache.
+ */
+
+#ifdef CONFIG_MM_HEAP_PERCPU_CACHE
+struct mm_cache_s
+{
+  spinlock_t mc_lock;
+  FAR struct mm_delaynode_s *mc_list[MM_CACHE_NCLASSES];
+  uint16_t mc_count[MM_CACHE_NCLASSES];
+  size_t mc_nblocks;                        /* Number of cached chunks */
+  size_t mc_nbytes;                         /* Total size of cached chunks */
+};
+#endif
+
 /* This describes one heap (possibly with multiple regions) */
 
 struct mm_heap_s
@@ -257,6 +289,12 @@ struct mm_heap_s
   size_t mm_delaycount[CONFIG_SMP_NCPUS];
 #endif
 
+  /* Per-CPU caches of small chunks, see mm_cache.c */
+
+#ifdef CONFIG_MM_HEAP_PERCPU_CACHE
+  struct mm_cache_s mm_cache[CONFIG_SMP_NCPUS];
+#endif
+
   /* The is a multiple mempool of the heap */
 
 #ifdef CONFIG_MM_HEAP_MEMPOOL
@@ -295,9 +333,25 @@ void mm_shrinkchunk(FAR struct mm_heap_s *heap,
 void mm_foreach(FAR struct mm_heap_s *heap, mm_node_handler_t handler,
                 FAR void *arg);
 
+/* Functions contained in mm_malloc.c ***************************************/
+
+FAR struct mm_allocnode_s *mm_allocchunk(FAR struct mm_heap_s *heap,
+                                         size_t alignsize);
+
 /* Functions contained in mm_free.c *****************************************/
 
 void mm_delayfree(FAR struct mm_heap_s *heap, FAR void *mem, bool delay);
+void mm_freechunk(FAR struct mm_heap_s *heap,
+                  FAR struct mm_allocnode_s *node);
+
+/* Functions contained in mm_cache.c ****************************************/
+
+#ifdef MM_CACHE_ENABLED
+FAR struct mm_allocnode_s *mm_cache_alloc(FAR struct mm_heap_s *heap,
+                                          size_t alignsize);
+bool mm_cache_free(FAR struct mm_heap_s *heap, FAR void *mem);
+bool mm_cache_flush(FAR struct mm_heap_s *heap);
+#endif
 
 /****************************************************************************
  * Inline Functions
@@ -0,0 +1,371 @@
+/****************************************************************************
+ * mm/mm_heap/mm_cache.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <assert.h>
+#include <debug.h>
+#include <malloc.h>
+#include <string.h>
+
+#include <nuttx/arch.h>
+#include <nuttx/irq.h>
+#include <nuttx/mm/mm.h>
+#include <nuttx/mm/kasan.h>
+#include <nuttx/sched_note.h>
+#include <nuttx/spinlock.h>
+
+#include "mm_heap/mm.h"
+
+#ifdef MM_CACHE_ENABLED
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Number of chunks moved between a cache and the nodelist at once */
+
+#define MM_CACHE_BATCH  ((CONFIG_MM_HEAP_PERCPU_CACHE_DEPTH + 1) / 2)
+
+/* Cached chunks are owned by nobody, hide them from the per-task dumps
+ * like the chunks backing the mempools.
+ */
+
+#if CONFIG_MM_BACKTRACE >= 0
+#  define MM_CACHE_DISOWN(node) ((node)->pid = PID_MM_MEMPOOL)
+#else
+#  define MM_CACHE_DISOWN(node)
+#endif
+
+static_assert(CONFIG_MM_HEAP_PERCPU_CACHE_MAXSIZE >= MM_MIN_CHUNK,
+              "Cache size too small for the chunk size\n");
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mm_cache_push
+ *
+ * Description:
+ *   Add an allocated chunk to a list of the cache.
+ *
+ * Assumptions:
+ *   The lock of the cache is held.
+ *
+ ****************************************************************************/
+
+static void mm_cache_push(FAR struct mm_cache_s *cache, int ndx,
+                          FAR struct mm_allocnode_s *node)
+{
+  FAR struct mm_delaynode_s *tmp = (FAR struct mm_delaynode_s *)
+    ((FAR char *)node + MM_SIZEOF_ALLOCNODE);
+
+  MM_CACHE_DISOWN(node);
+  tmp->flink = cache->mc_list[ndx];
+  cache->mc_list[ndx] = tmp;
+  cache->mc_count[ndx]++;
+  cache->mc_nblocks++;
+  cache->mc_nbytes += MM_SIZEOF_NODE(node);
+}
+
+/****************************************************************************
+ * Name: mm_cache_pop
+ *
+ * Description:
+ *   Take the first chunk from a list of the cache, or NULL if it is empty.
+ *
+ * Assumptions:
+ *   The lock of the cache is held.
+ *
+ ****************************************************************************/
+
+static FAR struct mm_allocnode_s *mm_cache_pop(FAR struct mm_cache_s *cache,
+                                               int ndx)
+{
+  FAR struct mm_delaynode_s *tmp = cache->mc_list[ndx];
+  FAR struct mm_allocnode_s *node;
+
+  if (tmp == NULL)
+    {
+      return NULL;
+    }
+
+  node = (FAR struct mm_allocnode_s *)
+    ((FAR char *)tmp - MM_SIZEOF_ALLOCNODE);
+
+  cache->mc_list[ndx] = tmp->flink;
+  cache->mc_count[ndx]--;
+  cache->mc_nblocks--;
+  cache->mc_nbytes -= MM_SIZEOF_NODE(node);
+  return node;
+}
+
+/****************************************************************************
+ * Name: mm_cache_release
+ *
+ * Description:
+ *   Return a list of chunks taken from a cache to the nodelist, under a
+ *   single hold of the MM mutex if possible.
+ *
+ ****************************************************************************/
+
+static void mm_cache_release(FAR struct mm_heap_s *heap,
+                             FAR struct mm_delaynode_s *list)
+{
+  FAR struct mm_delaynode_s *tmp;
+
+  if (mm_lock(heap) < 0)
+    {
+      /* Let mm_delayfree() put them on the delay list */
+
+      while ((tmp = list) != NULL)
+        {
+          list = tmp->flink;
+          mm_delayfree(heap, tmp, false);
+        }
+
+      return;
+    }
+
+  while ((tmp = list) != NULL)
+    {
+      list = tmp->flink;
+      mm_freechunk(heap, (FAR struct mm_allocnode_s *)
+                   ((FAR char *)tmp - MM_SIZEOF_ALLOCNODE));
+    }
+
+  mm_unlock(heap);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mm_cache_alloc
+ *
+ * Description:
+ *   Take a chunk of at least alignsize bytes from the cache of this CPU.
+ *   An empty list is refilled with a batch of chunks taken from the
+ *   nodelist under a single hold of the MM mutex.  Return NULL if the size
+ *   is not cached or no chunk is available.
+ *
+ ****************************************************************************/
+
+FAR struct mm_allocnode_s *mm_cache_alloc(FAR struct mm_heap_s *heap,
+                                          size_t alignsize)
+{
+  FAR struct mm_allocnode_s *batch[MM_CACHE_BATCH];
+  FAR struct mm_allocnode_s *node;
+  FAR struct mm_cache_s *cache;
+  irqstate_t flags;
+  int ndx;
+  int n;
+
+  if (alignsize > CONFIG_MM_HEAP_PERCPU_CACHE_MAXSIZE)
+    {
+      return NULL;
+    }
+
+  ndx = MM_CACHE_CLASS(alignsize);
+
+  cache = &heap->mm_cache[this_cpu()];
+  flags = spin_lock_irqsave_notrace(&cache->mc_lock);
+  node  = mm_cache_pop(cache, ndx);
+  spin_unlock_irqrestore_notrace(&cache->mc_lock, flags);
+
+  if (node != NULL || up_interrupt_context())
+    {
+      return node;
+    }
+
+  /* Refill the list, the first chunk is for the caller */
+
+  if (mm_lock(heap) < 0)
+    {
+      return NULL;
+    }
+
+  for (n = 0; n < MM_CACHE_BATCH; n++)
+    {
+      batch[n] = mm_allocchunk(heap, alignsize);
+      if (batch[n] == NULL)
+        {
+          break;
+        }
+    }
+
+  mm_unlock(heap);
+
+  if (n > 1)
+    {
+      /* This may be another CPU by now, which is fine */
+
+      cache = &heap->mm_cache[this_cpu()];
+      flags = spin_lock_irqsave_notrace(&cache->mc_lock);
+      while (n > 1)
+        {
+          mm_cache_push(cache, ndx, batch[--n]);
+        }
+
+      spin_unlock_irqrestore_notrace(&cache->mc_lock, flags);
+    }
+
+  return n > 0 ? batch[0] : NULL;
+}
+
+/****************************************************************************
+ * Name: mm_cache_free
+ *
+ * Description:
+ *   Put a freed chunk in the cache of this CPU.  Half of a full list is
+ *   first returned to the nodelist.  Return false if the chunk is not
+ *   cached and must be freed normally.
+ *
+ ****************************************************************************/
+
+bool mm_cache_free(FAR struct mm_heap_s *heap, FAR void *mem)
+{
+  FAR struct mm_delaynode_s *drain = NULL;
+  FAR struct mm_allocnode_s *node;
+  FAR struct mm_cache_s *cache;
+  irqstate_t flags;
+  size_t nodesize;
+  int ndx;
+  int n;
+
+  node = (FAR struct mm_allocnode_s *)
+         ((FAR char *)kasan_reset_tag(mem) - MM_SIZEOF_ALLOCNODE);
+  nodesize = MM_SIZEOF_NODE(node);
+  if (nodesize > CONFIG_MM_HEAP_PERCPU_CACHE_MAXSIZE)
+    {
+      return false;
+    }
+
+  /* Sanity check against double-frees */
+
+  DEBUGASSERT(MM_NODE_IS_ALLOC(node));
+
+  ndx = MM_CACHE_CLASS(nodesize);
+
+  cache = &heap->mm_cache[this_cpu()];
+  flags = spin_lock_irqsave_notrace(&cache->mc_lock);
+  if (cache->mc_count[ndx] >= CONFIG_MM_HEAP_PERCPU_CACHE_DEPTH)
+    {
+      /* Full list, it can not be drained from an interrupt handler */
+
+      if (up_interrupt_context())
+        {
+          spin_unlock_irqrestore_notrace(&cache->mc_lock, flags);
+          return false;
+        }
+
+      for (n = 0; n < MM_CACHE_BATCH; n++)
+        {
+          FAR struct mm_delaynode_s *tmp = (FAR struct mm_delaynode_s *)
+            ((FAR char *)mm_cache_pop(cache, ndx) + MM_SIZEOF_ALLOCNODE);
+
+          tmp->flink = drain;
+          drain      = tmp;
+        }
+    }
+
+  spin_unlock_irqrestore_notrace(&cache->mc_lock, flags);
+
+#ifdef CONFIG_MM_FILL_ALLOCATIONS
+  memset(mem, MM_FREE_MAGIC, nodesize - MM_ALLOCNODE_OVERHEAD);
+#endif
+
+  kasan_poison(mem, nodesize - MM_ALLOCNODE_OVERHEAD);
+  sched_note_heap(NOTE_HEAP_FREE, heap, mem, nodesize, heap->mm_curused);
+
+  flags = spin_lock_irqsave_notrace(&cache->mc_lock);
+  mm_cache_push(cache, ndx, node);
+  spin_unlock_irqrestore_notrace(&cache->mc_lock, flags);
+
+  if (drain != NULL)
+    {
+      mm_cache_release(heap, drain);
+    }
+
+  return true;
+}
+
+/****************************************************************************
+ * Name: mm_cache_flush
+ *
+ * Description:
+ *   Return all the chunks cached by every CPU to the nodelist, so that an
+ *   allocation failing on one CPU can use the chunks freed on the others.
+ *   Return true if there was any.
+ *
+ ****************************************************************************/
+
+bool mm_cache_flush(FAR struct mm_heap_s *heap)
+{
+  FAR struct mm_delaynode_s *drain = NULL;
+  FAR struct mm_allocnode_s *node;
+  FAR struct mm_cache_s *cache;
+  irqstate_t flags;
+  int cpu;
+  int ndx;
+
+  if (up_interrupt_context())
+    {
+      return false;
+    }
+
+  for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      cache = &heap->mm_cache[cpu];
+      flags = spin_lock_irqsave_notrace(&cache->mc_lock);
+      for (ndx = 0; ndx < MM_CACHE_NCLASSES; ndx++)
+        {
+          while ((node = mm_cache_pop(cache, ndx)) != NULL)
+            {
+              FAR struct mm_delaynode_s *tmp =
+                (FAR struct mm_delaynode_s *)
+                ((FAR char *)node + MM_SIZEOF_ALLOCNODE);
+
+              tmp->flink = drain;
+              drain      = tmp;
+            }
+        }
+
+      spin_unlock_irqrestore_notrace(&cache->mc_lock, flags);
+    }
+
+  if (drain == NULL)
+    {
+      return false;
+    }
+
+  mm_cache_release(heap, drain);
+  return true;
+}
+
+#endif /* MM_CACHE_ENABLED */
@@ -83,11 +83,8 @@ static void add_delaylist(FAR struct mm_heap_s *heap, FAR void *mem)
 
 void mm_delayfree(FAR struct mm_heap_s *heap, FAR void *mem, bool delay)
 {
-  FAR struct mm_freenode_s *node;
-  FAR struct mm_freenode_s *prev;
-  FAR struct mm_freenode_s *next;
+  FAR struct mm_allocnode_s *node;
   size_t nodesize;
-  size_t prevsize;
 
   if (mm_lock(heap) < 0)
     {
@@ -127,7 +124,7 @@ void mm_delayfree(FAR struct mm_heap_s *heap, FAR void *mem, bool delay)
 
   /* Map the memory chunk into a free node */
 
-  node = (FAR struct mm_freenode_s *)
+  node = (FAR struct mm_allocnode_s *)
          ((FAR char *)kasan_reset_tag(mem) - MM_SIZEOF_ALLOCNODE);
   nodesize = MM_SIZEOF_NODE(node);
 
@@ -135,12 +132,38 @@ void mm_delayfree(FAR struct mm_heap_s *heap, FAR void *mem, bool delay)
 
   DEBUGASSERT(MM_NODE_IS_ALLOC(node));
 
+  mm_freechunk(heap, node);
+  sched_note_heap(NOTE_HEAP_FREE, heap, mem, nodesize, heap->mm_curused);
+  UNUSED(nodesize);
+  mm_unlock(heap);
+}
+
+/****************************************************************************
+ * Name: mm_freechunk
+ *
+ * Description:
+ *   Mark an allocated chunk free, merge it with the adjacent free chunks
+ *   and return it to the nodelist.
+ *
+ * Assumptions:
+ *   The caller holds the MM mutex.
+ *
+ ****************************************************************************/
+
+void mm_freechunk(FAR struct mm_heap_s *heap,
+                  FAR struct mm_allocnode_s *alloc)
+{
+  FAR struct mm_freenode_s *node = (FAR struct mm_freenode_s *)alloc;
+  FAR struct mm_freenode_s *prev;
+  FAR struct mm_freenode_s *next;
+  size_t nodesize = MM_SIZEOF_NODE(node);
+  size_t prevsize;
+
   node->size &= ~MM_ALLOC_BIT;
 
   /* Update heap statistics */
 
   heap->mm_curused -= nodesize;
-  sched_note_heap(NOTE_HEAP_FREE, heap, mem, nodesize, heap->mm_curused);
 
   /* Check if the following node is free and, if so, merge it */
 
@@ -217,7 +240,6 @@ void mm_delayfree(FAR struct mm_heap_s *heap, FAR void *mem, bool delay)
   /* Add the merged node to the nodelist */
 
   mm_addfreechunk(heap, node);
-  mm_unlock(heap);
 }
 
 /****************************************************************************
@@ -252,5 +274,14 @@ void mm_free(FAR struct mm_heap_s *heap, FAR void *mem)
     }
 #endif
 
+#ifdef MM_CACHE_ENABLED
+  /* Keep small chunks in the cache of this CPU */
+
+  if (mm_cache_free(heap, mem))
+    {
+      return;
+    }
+#endif
+
   mm_delayfree(heap, mem, CONFIG_MM_FREE_DELAYCOUNT_MAX > 0);
 }
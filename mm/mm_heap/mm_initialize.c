@@ -31,6 +31,7 @@
 #include <debug.h>
 
 #include <nuttx/sched_note.h>
+#include <nuttx/spinlock.h>
 #include <nuttx/mm/mm.h>
 #include <nuttx/mm/kasan.h>
 
@@ -271,6 +272,13 @@ FAR struct mm_heap_s *mm_initialize(FAR const char *name,
 
   nxmutex_init(&heap->mm_lock);
 
+#ifdef CONFIG_MM_HEAP_PERCPU_CACHE
+  for (i = 0; i < CONFIG_SMP_NCPUS; i++)
+    {
+      spin_lock_init(&heap->mm_cache[i].mc_lock);
+    }
+#endif
+
 #if defined(CONFIG_FS_PROCFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_MEMINFO)
 #  if defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__)
   heap->mm_procfs.name = name;
@@ -47,6 +47,33 @@ struct mm_mallinfo_handler_s
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: mm_cache_size
+ *
+ * Description:
+ *   Return the total size of the chunks held in the per-CPU caches and
+ *   their number in nblocks.  They are allocated from the nodelist's point
+ *   of view but are free to the heap users.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MM_HEAP_PERCPU_CACHE
+static size_t mm_cache_size(FAR struct mm_heap_s *heap, FAR size_t *nblocks)
+{
+  size_t nbytes = 0;
+  int cpu;
+
+  *nblocks = 0;
+  for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      *nblocks += heap->mm_cache[cpu].mc_nblocks;
+      nbytes   += heap->mm_cache[cpu].mc_nbytes;
+    }
+
+  return nbytes;
+}
+#endif
+
 static void mallinfo_handler(FAR struct mm_allocnode_s *node, FAR void *arg)
 {
   FAR struct mallinfo *info = arg;
@@ -131,6 +158,10 @@ struct mallinfo mm_mallinfo(FAR struct mm_heap_s *heap)
 #ifdef CONFIG_MM_HEAP_MEMPOOL
   struct mallinfo poolinfo;
 #endif
+#ifdef CONFIG_MM_HEAP_PERCPU_CACHE
+  size_t cachesize;
+  size_t ncached;
+#endif
 
   memset(&info, 0, sizeof(info));
   mm_foreach(heap, mallinfo_handler, &info);
@@ -146,6 +177,16 @@ struct mallinfo mm_mallinfo(FAR struct mm_heap_s *heap)
   info.fordblks += poolinfo.fordblks;
 #endif
 
+#ifdef CONFIG_MM_HEAP_PERCPU_CACHE
+  /* The cached chunks are counted as free */
+
+  cachesize      = mm_cache_size(heap, &ncached);
+  info.uordblks -= cachesize;
+  info.fordblks += cachesize;
+  info.aordblks -= ncached;
+  info.ordblks  += ncached;
+#endif
+
   DEBUGASSERT(info.uordblks + info.fordblks == info.arena);
 
   return info;
@@ -190,7 +231,14 @@ struct mallinfo_task mm_mallinfo_task(FAR struct mm_heap_s *heap,
 
 size_t mm_heapfree(FAR struct mm_heap_s *heap)
 {
+#ifdef CONFIG_MM_HEAP_PERCPU_CACHE
+  size_t ncached;
+
+  return heap->mm_heapsize - heap->mm_curused +
+         mm_cache_size(heap, &ncached);
+#else
   return heap->mm_heapsize - heap->mm_curused;
+#endif
 }
 
 /****************************************************************************
@@ -273,6 +273,41 @@ void local_addref(FAR struct local_conn_s *conn);
 
 void local_subref(FAR struct local_conn_s *conn);
 
+/****************************************************************************
+ * Name: local_lock and local_unlock
+ *
+ * Description:
+ *   Take and release the recursive lock protecting the Unix domain
+ *   connections.  It is used instead of net_lock() by all of the local
+ *   socket logic.
+ *
+ ****************************************************************************/
+
+int local_lock(void);
+void local_unlock(void);
+
+/****************************************************************************
+ * Name: local_sem_wait
+ *
+ * Description:
+ *   Wait for sem while temporarily releasing the local lock.
+ *
+ ****************************************************************************/
+
+int local_sem_wait(FAR sem_t *sem);
+
+/****************************************************************************
+ * Name: local_closectl
+ *
+ * Description:
+ *   Close and free control file pointers, with the local lock released.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_LOCAL_SCM
+void local_closectl(FAR struct file **filps, int count);
+#endif
+
 /****************************************************************************
  * Name: local_nextconn
  *
@@ -280,7 +315,7 @@ void local_subref(FAR struct local_conn_s *conn);
  *   Traverse the list of allocated Local connections
  *
  * Assumptions:
- *   Called from network stack logic with the network stack locked
+ *   Called with the local lock held
  *
  ****************************************************************************/
 
@@ -293,7 +328,7 @@ FAR struct local_conn_s *local_nextconn(FAR struct local_conn_s *conn);
  *   Traverse the connections list to find the server
  *
  * Assumptions:
- *   This function must be called with the network locked.
+ *   This function must be called with the local lock held.
  *
  ****************************************************************************/
 
@@ -308,7 +343,7 @@ local_findconn(FAR const struct local_conn_s *conn,
  *   Traverse the connections list to find the peer
  *
  * Assumptions:
- *   This function must be called with the network locked.
+ *   This function must be called with the local lock held.
  *
  ****************************************************************************/
 
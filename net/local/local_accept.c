@@ -56,7 +56,7 @@ static int local_waitlisten(FAR struct local_conn_s *server)
     {
       /* No.. wait for a connection or a signal */
 
-      ret = net_sem_wait(&server->lc_waitsem);
+      ret = local_sem_wait(&server->lc_waitsem);
       if (ret < 0)
         {
           return ret;
@@ -34,6 +34,8 @@
 
 #include <nuttx/sched.h>
 #include <nuttx/kmalloc.h>
+#include <nuttx/mutex.h>
+#include <nuttx/semaphore.h>
 #include <nuttx/queue.h>
 
 #include "local/local.h"
@@ -46,10 +48,90 @@
 
 static dq_queue_t g_local_connections;
 
+/* Unix domain sockets share no state with the rest of the network stack,
+ * so they are serialized by their own lock rather than by net_lock().
+ */
+
+static rmutex_t g_local_lock = NXRMUTEX_INITIALIZER;
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: local_lock
+ *
+ * Description:
+ *   Take the lock protecting the Unix domain connections.
+ *
+ ****************************************************************************/
+
+int local_lock(void)
+{
+  return nxrmutex_lock(&g_local_lock);
+}
+
+/****************************************************************************
+ * Name: local_unlock
+ *
+ * Description:
+ *   Release the lock protecting the Unix domain connections.
+ *
+ ****************************************************************************/
+
+void local_unlock(void)
+{
+  nxrmutex_unlock(&g_local_lock);
+}
+
+/****************************************************************************
+ * Name: local_sem_wait
+ *
+ * Description:
+ *   Wait for sem while temporarily releasing the local lock, like
+ *   net_sem_wait() does for the network lock.
+ *
+ ****************************************************************************/
+
+int local_sem_wait(FAR sem_t *sem)
+{
+  unsigned int count;
+  int ret;
+
+  nxrmutex_breaklock(&g_local_lock, &count);
+  ret = nxsem_wait(sem);
+  nxrmutex_restorelock(&g_local_lock, count);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: local_closectl
+ *
+ * Description:
+ *   Close and free the control file pointers already taken from the
+ *   connections.  They may be sockets of other families whose close takes
+ *   the network lock, so the local lock is released meanwhile if the
+ *   caller holds it.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_LOCAL_SCM
+void local_closectl(FAR struct file **filps, int count)
+{
+  unsigned int lcount;
+
+  nxrmutex_breaklock(&g_local_lock, &lcount);
+
+  while (count-- > 0)
+    {
+      file_close(filps[count]);
+      kmm_free(filps[count]);
+    }
+
+  nxrmutex_restorelock(&g_local_lock, lcount);
+}
+#endif /* CONFIG_NET_LOCAL_SCM */
+
 /****************************************************************************
  * Name: local_nextconn
  *
@@ -57,7 +139,7 @@ static dq_queue_t g_local_connections;
  *   Traverse the list of local connections
  *
  * Assumptions:
- *   This function must be called with the network locked.
+ *   This function must be called with the local lock held.
  *
  ****************************************************************************/
 
@@ -78,7 +160,7 @@ FAR struct local_conn_s *local_nextconn(FAR struct local_conn_s *conn)
  *   Traverse the connections list to find the local connection
  *
  * Assumptions:
- *   This function must be called with the network locked.
+ *   This function must be called with the local lock held.
  *
  ****************************************************************************/
 
@@ -110,7 +192,7 @@ local_findconn(FAR const struct local_conn_s *local_conn,
  *   Traverse the connections list to find the peer
  *
  * Assumptions:
- *   This function must be called with the network locked.
+ *   This function must be called with the local lock held.
  *
  ****************************************************************************/
 
@@ -139,7 +221,7 @@ FAR struct local_conn_s *local_peerconn(FAR struct local_conn_s *conn)
  *   API
  *
  * Assumptions:
- *   This function must be called with the network locked.
+ *   This function must be called with the local lock held.
  *
  ****************************************************************************/
 
@@ -192,7 +274,7 @@ FAR struct local_conn_s *local_alloc(void)
  *    a new connection and initialize it.
  *
  * Assumptions:
- *   This function must be called with the network locked.
+ *   This function must be called with the local lock held.
  *
  ****************************************************************************/
 
@@ -284,7 +366,7 @@ err:
  *   This should be done by the implementation of close().
  *
  * Assumptions:
- *   This function must be called with the network locked.
+ *   This function must be called with the local lock held.
  *
  ****************************************************************************/
 
@@ -323,17 +405,17 @@ void local_free(FAR struct local_conn_s *conn)
     }
 
 #ifdef CONFIG_NET_LOCAL_SCM
-  /* Free the pending control file pointer */
+  /* Free the pending control file pointers.  The connection is no longer
+   * reachable, so local_closectl() may release the local lock.
+   */
 
+  local_closectl(conn->lc_cfps, conn->lc_cfpcount);
   for (i = 0; i < conn->lc_cfpcount; i++)
     {
-      if (conn->lc_cfps[i])
-        {
-          file_close(conn->lc_cfps[i]);
-          kmm_free(conn->lc_cfps[i]);
-          conn->lc_cfps[i] = NULL;
-        }
+      conn->lc_cfps[i] = NULL;
     }
+
+  conn->lc_cfpcount = 0;
 #endif /* CONFIG_NET_LOCAL_SCM */
 
   /* Destroy all FIFOs associted with the connection */
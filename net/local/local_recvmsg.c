@@ -140,12 +140,13 @@ static int psock_fifo_read(FAR struct socket *psock, FAR void *buf,
 static void local_recvctl(FAR struct local_conn_s *conn,
                           FAR struct msghdr *msg, int flags)
 {
+  FAR struct file *filps[LOCAL_NCONTROLFDS];
   FAR struct local_conn_s *peer;
   int count;
   int *fds;
   int i;
 
-  net_lock();
+  local_lock();
 
   if (conn->lc_peer == NULL)
     {
@@ -172,33 +173,36 @@ static void local_recvctl(FAR struct local_conn_s *conn,
       goto out;
     }
 
+  /* Take the files from the connection, then install and close them
+   * without the local lock:  file_dup() and file_close() of a socket of
+   * another family take the network lock (see net/utils/net_lock.c).
+   */
+
   count = peer->lc_cfpcount;
   for (i = 0; i < count; i++)
     {
-      fds[i] = file_dup(peer->lc_cfps[i], 0,
-                        flags & MSG_CMSG_CLOEXEC ? O_CLOEXEC : 0);
-      file_close(peer->lc_cfps[i]);
-      kmm_free(peer->lc_cfps[i]);
+      filps[i] = peer->lc_cfps[i];
       peer->lc_cfps[i] = NULL;
-      peer->lc_cfpcount--;
-      if (fds[i] < 0)
-        {
-          i++;
-          break;
-        }
     }
 
-  if (i > 0)
+  peer->lc_cfpcount = 0;
+  local_unlock();
+
+  for (i = 0; i < count; i++)
     {
-      if (peer->lc_cfpcount)
+      fds[i] = file_dup(filps[i], 0,
+                        flags & MSG_CMSG_CLOEXEC ? O_CLOEXEC : 0);
+      if (fds[i] < 0)
         {
-          memmove(peer->lc_cfps[0], peer->lc_cfps[i],
-                  sizeof(FAR void *) * peer->lc_cfpcount);
+          break;
         }
     }
 
+  local_closectl(filps, count);
+  return;
+
 out:
-  net_unlock();
+  local_unlock();
 }
 #endif /* CONFIG_NET_LOCAL_SCM */
 
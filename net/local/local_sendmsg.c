@@ -61,34 +61,44 @@
 #ifdef CONFIG_NET_LOCAL_SCM
 static void local_freectl(FAR struct local_conn_s *conn, int count)
 {
-  FAR struct local_conn_s *peer = conn->lc_peer;
+  FAR struct file *filps[LOCAL_NCONTROLFDS];
+  FAR struct local_conn_s *peer;
+  int nfds = 0;
+
+  local_lock();
+  peer = conn->lc_peer;
+  if (peer == NULL)
+    {
+      peer = conn;
+    }
 
-  while (count-- > 0)
+  while (count-- > 0 && peer->lc_cfpcount > 0)
     {
-      file_close(peer->lc_cfps[--peer->lc_cfpcount]);
-      kmm_free(peer->lc_cfps[peer->lc_cfpcount]);
+      filps[nfds++] = peer->lc_cfps[--peer->lc_cfpcount];
       peer->lc_cfps[peer->lc_cfpcount] = NULL;
     }
+
+  local_unlock();
+  local_closectl(filps, nfds);
 }
 
 static int local_sendctl(FAR struct local_conn_s *conn,
                          FAR struct msghdr *msg)
 {
+  FAR struct file *filps[LOCAL_NCONTROLFDS];
   FAR struct local_conn_s *peer;
-  FAR struct file *filep2;
   FAR struct file *filep;
   FAR struct cmsghdr *cmsg;
-  int count = 0;
+  int nfds = 0;
+  int count;
   FAR int *fds;
   int ret;
-  int i = 0;
+  int i;
 
-  net_lock();
-  peer = conn->lc_peer;
-  if (peer == NULL)
-    {
-      peer = conn;
-    }
+  /* Duplicate the files before taking the local lock:  file_dup2() of a
+   * socket of another family takes the network lock, which is never taken
+   * with the local lock held (see net/utils/net_lock.c).
+   */
 
   for_each_cmsghdr(cmsg, msg)
     {
@@ -103,7 +113,7 @@ static int local_sendctl(FAR struct local_conn_s *conn,
       fds = (FAR int *)CMSG_DATA(cmsg);
       count = (cmsg->cmsg_len - sizeof(struct cmsghdr)) / sizeof(int);
 
-      if (count + peer->lc_cfpcount >= LOCAL_NCONTROLFDS)
+      if (nfds + count >= LOCAL_NCONTROLFDS)
         {
           ret = -EMFILE;
           goto fail;
@@ -117,32 +127,50 @@ static int local_sendctl(FAR struct local_conn_s *conn,
               goto fail;
             }
 
-          filep2 = kmm_zalloc(sizeof(*filep2));
-          if (!filep2)
+          filps[nfds] = kmm_zalloc(sizeof(struct file));
+          if (filps[nfds] == NULL)
             {
               fs_putfilep(filep);
               ret = -ENOMEM;
               goto fail;
             }
 
-          ret = file_dup2(filep, filep2);
+          ret = file_dup2(filep, filps[nfds]);
           fs_putfilep(filep);
           if (ret < 0)
             {
-              kmm_free(filep2);
+              kmm_free(filps[nfds]);
               goto fail;
             }
 
-          peer->lc_cfps[peer->lc_cfpcount++] = filep2;
+          nfds++;
         }
     }
 
-  net_unlock();
-  return count;
+  local_lock();
+  peer = conn->lc_peer;
+  if (peer == NULL)
+    {
+      peer = conn;
+    }
+
+  if (nfds + peer->lc_cfpcount >= LOCAL_NCONTROLFDS)
+    {
+      local_unlock();
+      ret = -EMFILE;
+      goto fail;
+    }
+
+  for (i = 0; i < nfds; i++)
+    {
+      peer->lc_cfps[peer->lc_cfpcount++] = filps[i];
+    }
+
+  local_unlock();
+  return nfds;
 
 fail:
-  local_freectl(conn, i);
-  net_unlock();
+  local_closectl(filps, nfds);
   return ret;
 }
 #endif /* CONFIG_NET_LOCAL_SCM */
@@ -311,17 +339,17 @@ static ssize_t local_sendto(FAR struct socket *psock,
       return -EISCONN;
     }
 
-  net_lock();
+  local_lock();
 
   server = local_findconn(conn, unaddr);
   if (server == NULL)
     {
-      net_unlock();
+      local_unlock();
       nerr("ERROR: No such file or directory\n");
       return -ENOENT;
     }
 
-  net_unlock();
+  local_unlock();
 
   /* Make sure that dgram is sent safely */
 
@@ -462,9 +490,7 @@ ssize_t local_sendmsg(FAR struct socket *psock, FAR struct msghdr *msg,
 
   if (len < 0 && count > 0)
     {
-      net_lock();
       local_freectl(conn, count);
-      net_unlock();
     }
 #else
   len = to ? local_sendto(psock, buf, len, flags, to, tolen) :
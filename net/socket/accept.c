@@ -41,6 +41,7 @@
 #include <arch/irq.h>
 
 #include "socket/socket.h"
+#include "utils/utils.h"
 
 /****************************************************************************
  * Public Functions
@@ -147,7 +148,7 @@ int psock_accept(FAR struct socket *psock, FAR struct sockaddr *addr,
       return -EOPNOTSUPP;
     }
 
-  net_lock();
+  psock_lock(psock);
   ret = psock->s_sockif->si_accept(psock, addr, addrlen, newsock, flags);
   if (ret >= 0)
     {
@@ -166,6 +167,6 @@ int psock_accept(FAR struct socket *psock, FAR struct sockaddr *addr,
       nerr("ERROR: si_accept failed: %d\n", ret);
     }
 
-  net_unlock();
+  psock_unlock(psock);
   return ret;
 }
@@ -160,7 +160,7 @@ static int psock_socketlevel_option(FAR struct socket *psock, int option,
            * options.
            */
 
-           net_lock();
+          psock_lock(psock);
 
           /* Set or clear the option bit */
 
@@ -173,7 +173,7 @@ static int psock_socketlevel_option(FAR struct socket *psock, int option,
               _SO_CLROPT(conn->s_options, option);
             }
 
-          net_unlock();
+          psock_unlock(psock);
         }
         break;
 
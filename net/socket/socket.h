@@ -123,6 +123,15 @@
 #  define _SO_SETERRNO(s,e)
 #endif /* CONFIG_NET_SOCKOPTS */
 
+/* sendmmsg() and recvmmsg() hold the network lock across all the messages
+ * of the datagram sockets of the IP stack: their blocking waits break the
+ * lock, so holding it does not block the network.
+ */
+
+#define _SO_MMSG_NETLOCK(s) \
+  (((s)->s_domain == PF_INET || (s)->s_domain == PF_INET6) && \
+   (s)->s_type == SOCK_DGRAM)
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -58,6 +58,7 @@
 
 #include <nuttx/clock.h>
 #include <nuttx/kmalloc.h>
+#include <nuttx/nuttx.h>
 #include <nuttx/net/netconfig.h>
 #include <nuttx/net/net.h>
 #include <nuttx/net/netdev.h>
@@ -95,10 +96,136 @@ NET_BUFPOOL_DECLARE(g_tcp_connections, sizeof(struct tcp_conn_s),
 
 static dq_queue_t g_active_tcp_connections;
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+/* The connected TCP connections hashed by local port, remote port and
+ * remote address.  The local address is not part of the key because a
+ * connection bound to INADDR_ANY accepts packets for any local address.
+ */
+
+static dq_queue_t g_tcp_connhash[CONFIG_NET_TCP_CONN_HASHSIZE];
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: tcp_connhash
+ *
+ * Description:
+ *   Return the hash bucket of the connections with the given local port,
+ *   remote port and (folded) remote address.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_CONN_HASH
+static inline_function FAR dq_queue_t *
+  tcp_connhash(uint16_t lport, uint16_t rport, uint32_t raddr)
+{
+  uint32_t hash = (((uint32_t)lport << 16) | rport) ^ raddr;
+
+  /* Multiplicative hashing, keep the well mixed upper bits */
+
+  hash *= 0x9e3779b1;
+  return &g_tcp_connhash[(hash >> 16) % CONFIG_NET_TCP_CONN_HASHSIZE];
+}
+
+#ifdef CONFIG_NET_IPv6
+static inline_function uint32_t tcp_ipv6_fold(FAR const uint16_t *addr)
+{
+  return (((uint32_t)addr[0] << 16) | addr[1]) ^
+         (((uint32_t)addr[2] << 16) | addr[3]) ^
+         (((uint32_t)addr[4] << 16) | addr[5]) ^
+         (((uint32_t)addr[6] << 16) | addr[7]);
+}
+#endif
+
+static FAR dq_queue_t *tcp_conn_bucket(FAR struct tcp_conn_s *conn)
+{
+#ifdef CONFIG_NET_IPv6
+#ifdef CONFIG_NET_IPv4
+  if (conn->domain == PF_INET6)
+#endif
+    {
+      return tcp_connhash(conn->lport, conn->rport,
+                          tcp_ipv6_fold(conn->u.ipv6.raddr));
+    }
+#endif /* CONFIG_NET_IPv6 */
+
+#ifdef CONFIG_NET_IPv4
+#ifdef CONFIG_NET_IPv6
+  else
+#endif
+    {
+      return tcp_connhash(conn->lport, conn->rport, conn->u.ipv4.raddr);
+    }
+#endif /* CONFIG_NET_IPv4 */
+}
+#endif /* CONFIG_NET_TCP_CONN_HASH */
+
+/****************************************************************************
+ * Name: tcp_addactive
+ *
+ * Description:
+ *   Add the connection to the list of active connections once its local
+ *   and remote ports and addresses are known.
+ *
+ * Assumptions:
+ *   This function is called with the network locked.
+ *
+ ****************************************************************************/
+
+static void tcp_addactive(FAR struct tcp_conn_s *conn)
+{
+  dq_addlast(&conn->sconn.node, &g_active_tcp_connections);
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  dq_addlast(&conn->hnode, tcp_conn_bucket(conn));
+#endif
+}
+
+/****************************************************************************
+ * Name: tcp_remactive
+ *
+ * Description:
+ *   Remove the connection from the list of active connections.
+ *
+ * Assumptions:
+ *   This function is called with the network locked.
+ *
+ ****************************************************************************/
+
+static void tcp_remactive(FAR struct tcp_conn_s *conn)
+{
+  dq_rem(&conn->sconn.node, &g_active_tcp_connections);
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  dq_rem(&conn->hnode, tcp_conn_bucket(conn));
+#endif
+}
+
+/****************************************************************************
+ * Name: tcp_firstactive
+ *
+ * Description:
+ *   Return the first active connection that may match a packet with the
+ *   given ports and remote address.  tcp_nextactive() returns the next one.
+ *   With CONFIG_NET_TCP_CONN_HASH only the connections of one hash bucket
+ *   are visited, otherwise all active connections are.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_CONN_HASH
+#  define tcp_firstactive(lport, rport, raddr) \
+     tcp_hashentry(dq_peek(tcp_connhash(lport, rport, raddr)))
+#  define tcp_nextactive(conn)   tcp_hashentry((conn)->hnode.flink)
+#  define tcp_hashentry(node) \
+     ((node) != NULL ? container_of(node, struct tcp_conn_s, hnode) : NULL)
+#else
+#  define tcp_firstactive(lport, rport, raddr) \
+     ((FAR struct tcp_conn_s *)g_active_tcp_connections.head)
+#  define tcp_nextactive(conn) \
+     ((FAR struct tcp_conn_s *)(conn)->sconn.node.flink)
+#endif
+
 /****************************************************************************
  * Name: tcp_listener
  *
@@ -195,9 +322,9 @@ static inline FAR struct tcp_conn_s *
   in_addr_t srcipaddr;
   in_addr_t destipaddr;
 
-  conn       = (FAR struct tcp_conn_s *)g_active_tcp_connections.head;
   srcipaddr  = net_ip4addr_conv32(ip->srcipaddr);
   destipaddr = net_ip4addr_conv32(ip->destipaddr);
+  conn       = tcp_firstactive(tcp->destport, tcp->srcport, srcipaddr);
 
   while (conn)
     {
@@ -234,7 +361,7 @@ static inline FAR struct tcp_conn_s *
 
       /* Look at the next active connection */
 
-      conn = (FAR struct tcp_conn_s *)conn->sconn.node.flink;
+      conn = tcp_nextactive(conn);
     }
 
   return conn;
@@ -262,9 +389,10 @@ static inline FAR struct tcp_conn_s *
   net_ipv6addr_t *srcipaddr;
   net_ipv6addr_t *destipaddr;
 
-  conn       = (FAR struct tcp_conn_s *)g_active_tcp_connections.head;
   srcipaddr  = (net_ipv6addr_t *)ip->srcipaddr;
   destipaddr = (net_ipv6addr_t *)ip->destipaddr;
+  conn       = tcp_firstactive(tcp->destport, tcp->srcport,
+                               tcp_ipv6_fold(*srcipaddr));
 
   while (conn)
     {
@@ -301,7 +429,7 @@ static inline FAR struct tcp_conn_s *
 
       /* Look at the next active connection */
 
-      conn = (FAR struct tcp_conn_s *)conn->sconn.node.flink;
+      conn = tcp_nextactive(conn);
     }
 
   return conn;
@@ -859,7 +987,7 @@ void tcp_free(FAR struct tcp_conn_s *conn)
     {
       /* Remove the connection from the active list */
 
-      dq_rem(&conn->sconn.node, &g_active_tcp_connections);
+      tcp_remactive(conn);
     }
 
   tcp_free_rx_buffers(conn);
@@ -1156,7 +1284,7 @@ FAR struct tcp_conn_s *tcp_alloc_accept(FAR struct net_driver_s *dev,
        * Interrupts should already be disabled in this context.
        */
 
-      dq_addlast(&conn->sconn.node, &g_active_tcp_connections);
+      tcp_addactive(conn);
       tcp_update_retrantimer(conn, TCP_RTO);
     }
 
@@ -1467,7 +1595,7 @@ int tcp_connect(FAR struct tcp_conn_s *conn, FAR const struct sockaddr *addr)
 
   /* And, finally, put the connection structure into the active list. */
 
-  dq_addlast(&conn->sconn.node, &g_active_tcp_connections);
+  tcp_addactive(conn);
   ret = OK;
 
 errout_with_lock:
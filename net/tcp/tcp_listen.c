@@ -50,6 +50,7 @@
 #include <stdbool.h>
 #include <debug.h>
 
+#include <nuttx/nuttx.h>
 #include <nuttx/net/netconfig.h>
 #include <nuttx/net/net.h>
 
@@ -61,14 +62,81 @@
  * Private Data
  ****************************************************************************/
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+/* The listening connections hashed by local port number */
+
+static dq_queue_t g_tcp_listenhash[CONFIG_NET_TCP_CONN_HASHSIZE];
+static int g_tcp_nlisteners;
+
+#  define TCP_LISTENHASH(portno) \
+     (&g_tcp_listenhash[(portno) % CONFIG_NET_TCP_CONN_HASHSIZE])
+#else
 /* The tcp_listenports list all currently listening ports. */
 
 static FAR struct tcp_conn_s *tcp_listenports[CONFIG_NET_MAX_LISTENPORTS];
+#endif
 
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: tcp_matchlistener
+ *
+ * Description:
+ *   Return true if the listening connection accepts connections for this
+ *   local address and port.
+ *
+ ****************************************************************************/
+
+static bool tcp_matchlistener(FAR struct tcp_conn_s *conn,
+                              FAR union ip_binding_u *uaddr,
+                              uint16_t portno, uint8_t domain)
+{
+#if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
+  if (conn->lport != portno || conn->domain != domain)
+#else
+  UNUSED(domain);
+
+  if (conn->lport != portno)
+#endif
+    {
+      return false;
+    }
+
+#ifdef CONFIG_NET_IPv6
+#  ifdef CONFIG_NET_IPv4
+  if (domain == PF_INET6)
+#  endif
+    {
+      if (net_ipv6addr_cmp(conn->u.ipv6.laddr, uaddr->ipv6.laddr) ||
+          net_ipv6addr_cmp(conn->u.ipv6.laddr, g_ipv6_unspecaddr))
+        {
+          /* Yes.. we found a listener on this port */
+
+          return true;
+        }
+    }
+#endif
+
+#ifdef CONFIG_NET_IPv4
+#  ifdef CONFIG_NET_IPv6
+  if (domain == PF_INET)
+#  endif
+    {
+      if (net_ipv4addr_cmp(conn->u.ipv4.laddr, uaddr->ipv4.laddr) ||
+          net_ipv4addr_cmp(conn->u.ipv4.laddr, INADDR_ANY))
+        {
+          /* Yes.. we found a listener on this port */
+
+          return true;
+        }
+    }
+#endif
+
+  return false;
+}
+
 /****************************************************************************
  * Name: tcp_findlistener
  *
@@ -89,8 +157,29 @@ FAR struct tcp_conn_s *tcp_findlistener(FAR union ip_binding_u *uaddr,
                                         uint16_t portno)
 #endif
 {
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  FAR dq_entry_t *node;
+#else
   int ndx;
+#endif
+#if !defined(CONFIG_NET_IPv4) || !defined(CONFIG_NET_IPv6)
+  uint8_t domain = 0;
+#endif
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  /* Examine each connection structure listening on this hash bucket */
+
+  for (node = dq_peek(TCP_LISTENHASH(portno)); node; node = dq_next(node))
+    {
+      FAR struct tcp_conn_s *conn =
+        container_of(node, struct tcp_conn_s, lnode);
+
+      if (tcp_matchlistener(conn, uaddr, portno, domain))
+        {
+          return conn;
+        }
+    }
+#else
   /* Examine each connection structure in each slot of the listener list */
 
   for (ndx = 0; ndx < CONFIG_NET_MAX_LISTENPORTS; ndx++)
@@ -100,43 +189,12 @@ FAR struct tcp_conn_s *tcp_findlistener(FAR union ip_binding_u *uaddr,
        */
 
       FAR struct tcp_conn_s *conn = tcp_listenports[ndx];
-#if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
-      if (conn && conn->lport == portno && conn->domain == domain)
-#else
-      if (conn && conn->lport == portno)
-#endif
+      if (conn && tcp_matchlistener(conn, uaddr, portno, domain))
         {
-#ifdef CONFIG_NET_IPv6
-#  ifdef CONFIG_NET_IPv4
-          if (domain == PF_INET6)
-#  endif
-            {
-              if (net_ipv6addr_cmp(conn->u.ipv6.laddr, uaddr->ipv6.laddr) ||
-                  net_ipv6addr_cmp(conn->u.ipv6.laddr, g_ipv6_unspecaddr))
-                {
-                  /* Yes.. we found a listener on this port */
-
-                  return conn;
-                }
-            }
-#endif
-
-#ifdef CONFIG_NET_IPv4
-#  ifdef CONFIG_NET_IPv6
-          if (domain == PF_INET)
-#  endif
-            {
-              if (net_ipv4addr_cmp(conn->u.ipv4.laddr, uaddr->ipv4.laddr) ||
-                  net_ipv4addr_cmp(conn->u.ipv4.laddr, INADDR_ANY))
-                {
-                  /* Yes.. we found a listener on this port */
-
-                  return conn;
-                }
-            }
-#endif
+          return conn;
         }
     }
+#endif
 
   /* No listener for this port */
 
@@ -160,10 +218,28 @@ FAR struct tcp_conn_s *tcp_findlistener(FAR union ip_binding_u *uaddr,
 
 int tcp_unlisten(FAR struct tcp_conn_s *conn)
 {
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  FAR dq_queue_t *bucket;
+  FAR dq_entry_t *node;
+#else
   int ndx;
+#endif
   int ret = -EINVAL;
 
   net_lock();
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  bucket = TCP_LISTENHASH(conn->lport);
+  for (node = dq_peek(bucket); node; node = dq_next(node))
+    {
+      if (node == &conn->lnode)
+        {
+          dq_rem(node, bucket);
+          g_tcp_nlisteners--;
+          ret = OK;
+          break;
+        }
+    }
+#else
   for (ndx = 0; ndx < CONFIG_NET_MAX_LISTENPORTS; ndx++)
     {
       if (tcp_listenports[ndx] == conn)
@@ -173,6 +249,7 @@ int tcp_unlisten(FAR struct tcp_conn_s *conn)
           break;
         }
     }
+#endif
 
   net_unlock();
   return ret;
@@ -191,7 +268,9 @@ int tcp_unlisten(FAR struct tcp_conn_s *conn)
 
 int tcp_listen(FAR struct tcp_conn_s *conn)
 {
+#ifndef CONFIG_NET_TCP_CONN_HASH
   int ndx;
+#endif
   int ret;
 
   /* This must be done with network locked because the listener table
@@ -220,6 +299,14 @@ int tcp_listen(FAR struct tcp_conn_s *conn)
 
       ret = -ENOBUFS; /* Assume failure */
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+      if (g_tcp_nlisteners < CONFIG_NET_MAX_LISTENPORTS)
+        {
+          dq_addlast(&conn->lnode, TCP_LISTENHASH(conn->lport));
+          g_tcp_nlisteners++;
+          ret = OK;
+        }
+#else
       /* Search all slots until an available slot is found */
 
       for (ndx = 0; ndx < CONFIG_NET_MAX_LISTENPORTS; ndx++)
@@ -235,6 +322,7 @@ int tcp_listen(FAR struct tcp_conn_s *conn)
               break;
             }
         }
+#endif
     }
 
   net_unlock();
@@ -45,6 +45,7 @@
 #include <nuttx/sched.h>
 #include <nuttx/semaphore.h>
 #include <nuttx/fs/fs.h>
+#include <nuttx/fs/ioctl.h>
 #include <nuttx/net/net.h>
 #include <nuttx/net/netdev.h>
 #include <nuttx/net/tcp.h>
@@ -73,6 +74,8 @@ struct sendfile_s
   FAR struct tcp_conn_s *snd_conn;         /* Connection associated with the socket */
   FAR struct devif_callback_s *snd_cb;     /* Reference to callback instance */
   FAR struct file   *snd_file;             /* File structure of the input file */
+  FAR const uint8_t *snd_xipbase;          /* Data of a directly addressable
+                                            * input file, or NULL */
   sem_t              snd_sem;              /* Used to wake up the waiting thread */
   off_t              snd_foffset;          /* Input file offset */
   size_t             snd_flen;             /* File length */
@@ -96,6 +99,32 @@ struct sendfile_s
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: sendfile_copyin
+ *
+ * Description:
+ *   Put a segment of the input file in the device buffer.  The data of a
+ *   directly addressable, immutable file (romfs XIP) is copied from where
+ *   it lies, other files are read with file_read().
+ *
+ ****************************************************************************/
+
+static int sendfile_copyin(FAR struct net_driver_s *dev,
+                           FAR struct sendfile_s *pstate,
+                           uint32_t sndlen, off_t offset)
+{
+  FAR struct tcp_conn_s *conn = pstate->snd_conn;
+
+  if (pstate->snd_xipbase != NULL)
+    {
+      return devif_send(dev, pstate->snd_xipbase + offset, sndlen,
+                        tcpip_hdrsize(conn));
+    }
+
+  return devif_file_send(dev, pstate->snd_file, sndlen, offset,
+                         tcpip_hdrsize(conn));
+}
+
 /****************************************************************************
  * Name: sendfile_eventhandler
  *
@@ -269,9 +298,8 @@ static uint16_t sendfile_eventhandler(FAR struct net_driver_s *dev,
        * happen until the polling cycle completes).
        */
 
-      ret = devif_file_send(dev, pstate->snd_file, sndlen,
-                            pstate->snd_foffset + pstate->snd_acked,
-                            tcpip_hdrsize(conn));
+      ret = sendfile_copyin(dev, pstate, sndlen,
+                            pstate->snd_foffset + pstate->snd_acked);
       if (ret < 0)
         {
           nerr("ERROR: Failed to read from input file: %d\n", (int)ret);
@@ -340,9 +368,8 @@ static uint16_t sendfile_eventhandler(FAR struct net_driver_s *dev,
            * happen until the polling cycle completes).
            */
 
-          ret = devif_file_send(dev, pstate->snd_file, sndlen,
-                                pstate->snd_foffset + pstate->snd_sent,
-                                tcpip_hdrsize(conn));
+          ret = sendfile_copyin(dev, pstate, sndlen,
+                                pstate->snd_foffset + pstate->snd_sent);
           if (ret < 0)
             {
               nerr("ERROR: Failed to read from input file: %d\n", (int)ret);
@@ -418,7 +445,9 @@ ssize_t tcp_sendfile(FAR struct socket *psock, FAR struct file *infile,
 {
   FAR struct tcp_conn_s *conn;
   struct sendfile_s state;
+  uintptr_t xipbase;
   off_t startpos;
+  off_t foffset;
   int ret = OK;
 
   conn = psock->s_conn;
@@ -470,6 +499,40 @@ ssize_t tcp_sendfile(FAR struct socket *psock, FAR struct file *infile,
       return startpos;
     }
 
+  foffset = offset ? *offset : startpos;
+
+  /* A file whose data is directly addressable is sent from where it lies
+   * instead of being read segment by segment.  The address is used after
+   * the network lock is released, so file_xipbase() only returns it for
+   * data that cannot move.  Its size bounds the transfer, as file_read()
+   * would.
+   */
+
+  if (file_xipbase(infile, &xipbase) >= 0)
+    {
+      struct stat st;
+
+      ret = file_fstat(infile, &st);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      if (foffset >= st.st_size)
+        {
+          return 0;
+        }
+
+      if (count > st.st_size - foffset)
+        {
+          count = st.st_size - foffset;
+        }
+    }
+  else
+    {
+      xipbase = 0;
+    }
+
   /* Initialize the state structure.  This is done with the network
    * locked because we don't want anything to happen until we are
    * ready.
@@ -483,9 +546,10 @@ ssize_t tcp_sendfile(FAR struct socket *psock, FAR struct file *infile,
   nxsem_init(&state.snd_sem, 0, 0);                /* Doesn't really fail */
 
   state.snd_conn    = conn;                        /* Tcp conn to use */
-  state.snd_foffset = offset ? *offset : startpos; /* Input file offset */
+  state.snd_foffset = foffset;                     /* Input file offset */
   state.snd_flen    = count;                       /* Number of bytes to send */
   state.snd_file    = infile;                      /* File to read from */
+  state.snd_xipbase = (FAR const uint8_t *)xipbase;
 
   /* Allocate resources to receive a callback */
 
@@ -545,6 +609,19 @@ errout_locked:
 #endif
   net_unlock();
 
+  /* The position of a directly addressable file was not moved by reading,
+   * move it past the data sent.
+   */
+
+  if (state.snd_xipbase != NULL && state.snd_sent > 0)
+    {
+      off_t curpos = file_seek(infile, foffset + state.snd_sent, SEEK_SET);
+      if (curpos < 0)
+        {
+          return curpos;
+        }
+    }
+
   /* Return the current file position */
 
   if (offset)
@@ -110,6 +110,10 @@ struct udp_conn_s
 
   /* UDP-specific content follows */
 
+#ifdef CONFIG_NET_UDP_CONN_HASH
+  dq_entry_t hnode;       /* Supports the local port hash table */
+#endif
+
   union ip_binding_u u;   /* IP address binding */
   uint16_t lport;         /* Bound local port number (network byte order) */
   uint16_t rport;         /* Remote port number (network byte order) */
@@ -263,6 +267,22 @@ FAR struct udp_conn_s *udp_active(FAR struct net_driver_s *dev,
 
 FAR struct udp_conn_s *udp_nextconn(FAR struct udp_conn_s *conn);
 
+/****************************************************************************
+ * Name: udp_setport
+ *
+ * Description:
+ *   Set (or clear with portno == 0) the local port of the connection.  All
+ *   changes of conn->lport must go through this function so that the
+ *   connection can be found by its port number.
+ *
+ * Input Parameters:
+ *   conn   - The UDP connection
+ *   portno - The new local port number in network byte order
+ *
+ ****************************************************************************/
+
+void udp_setport(FAR struct udp_conn_s *conn, uint16_t portno);
+
 /****************************************************************************
  * Name: udp_select_port
  *
@@ -59,6 +59,7 @@
 #include <nuttx/clock.h>
 #include <nuttx/kmalloc.h>
 #include <nuttx/mutex.h>
+#include <nuttx/nuttx.h>
 #include <nuttx/net/netconfig.h>
 #include <nuttx/net/net.h>
 #include <nuttx/net/netdev.h>
@@ -97,10 +98,72 @@ static mutex_t g_free_lock = NXMUTEX_INITIALIZER;
 
 static dq_queue_t g_active_udp_connections;
 
+#ifdef CONFIG_NET_UDP_CONN_HASH
+/* The UDP connections with a non-zero local port hashed by that port */
+
+static dq_queue_t g_udp_porthash[CONFIG_NET_UDP_CONN_HASHSIZE];
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: udp_firstport
+ *
+ * Description:
+ *   Return the first connection that may be bound to the given local port
+ *   (network byte order).  udp_nextport() returns the next one.  With
+ *   CONFIG_NET_UDP_CONN_HASH only the connections of one hash bucket are
+ *   visited, otherwise all allocated connections are.  The caller must
+ *   still compare the port number.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_UDP_CONN_HASH
+#  define UDP_PORTHASH(portno) \
+     (&g_udp_porthash[NTOHS(portno) % CONFIG_NET_UDP_CONN_HASHSIZE])
+#  define udp_firstport(portno) \
+     udp_hashentry(dq_peek(UDP_PORTHASH(portno)))
+#  define udp_nextport(conn)    udp_hashentry((conn)->hnode.flink)
+#  define udp_hashentry(node) \
+     ((node) != NULL ? container_of(node, struct udp_conn_s, hnode) : NULL)
+#else
+#  define udp_firstport(portno) udp_nextconn(NULL)
+#  define udp_nextport(conn)    udp_nextconn(conn)
+#endif
+
+/****************************************************************************
+ * Name: udp_iswildcard
+ *
+ * Description:
+ *   Return true if the connection is bound to the wildcard local address.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_UDP_CONN_HASH
+static bool udp_iswildcard(FAR struct udp_conn_s *conn)
+{
+#ifdef CONFIG_NET_IPv6
+#ifdef CONFIG_NET_IPv4
+  if (conn->domain == PF_INET6)
+#endif
+    {
+      return net_ipv6addr_cmp(conn->u.ipv6.laddr, g_ipv6_unspecaddr);
+    }
+#endif /* CONFIG_NET_IPv6 */
+
+#ifdef CONFIG_NET_IPv4
+#ifdef CONFIG_NET_IPv6
+  else
+#endif
+    {
+      return net_ipv4addr_cmp(conn->u.ipv4.laddr, INADDR_ANY);
+    }
+#endif /* CONFIG_NET_IPv4 */
+}
+#endif /* CONFIG_NET_UDP_CONN_HASH */
+
 /****************************************************************************
  * Name: udp_find_conn()
  *
@@ -123,14 +186,15 @@ static FAR struct udp_conn_s *udp_find_conn(uint8_t domain,
                                             FAR union ip_binding_u *ipaddr,
                                             uint16_t portno, sockopt_t opt)
 {
-  FAR struct udp_conn_s *conn = NULL;
+  FAR struct udp_conn_s *conn;
 #ifdef CONFIG_NET_SOCKOPTS
   bool skip_reusable = _SO_GETOPT(opt, SO_REUSEADDR);
 #endif
 
-  /* Now search each connection structure. */
+  /* Now search each connection structure that may use this port. */
 
-  while ((conn = udp_nextconn(conn)) != NULL)
+  for (conn = udp_firstport(portno); conn != NULL;
+       conn = udp_nextport(conn))
     {
       /* With SO_REUSEADDR set for both sockets, we do not need to check its
        * address and port.
@@ -203,7 +267,7 @@ udp_ipv4_active(FAR struct net_driver_s *dev, FAR struct udp_conn_s *conn,
 #endif
   FAR struct ipv4_hdr_s *ip = IPv4BUF;
 
-  conn = udp_nextconn(conn);
+  conn = conn != NULL ? udp_nextport(conn) : udp_firstport(udp->destport);
 
   while (conn)
     {
@@ -317,7 +381,7 @@ udp_ipv4_active(FAR struct net_driver_s *dev, FAR struct udp_conn_s *conn,
 
       /* Look at the next active connection */
 
-      conn = (FAR struct udp_conn_s *)conn->sconn.node.flink;
+      conn = udp_nextport(conn);
     }
 
   return conn;
@@ -343,7 +407,7 @@ udp_ipv6_active(FAR struct net_driver_s *dev, FAR struct udp_conn_s *conn,
 {
   FAR struct ipv6_hdr_s *ip = IPv6BUF;
 
-  conn = udp_nextconn(conn);
+  conn = conn != NULL ? udp_nextport(conn) : udp_firstport(udp->destport);
 
   while (conn != NULL)
     {
@@ -457,7 +521,7 @@ udp_ipv6_active(FAR struct net_driver_s *dev, FAR struct udp_conn_s *conn,
 
       /* Look at the next active connection */
 
-      conn = (FAR struct udp_conn_s *)conn->sconn.node.flink;
+      conn = udp_nextport(conn);
     }
 
   return conn;
@@ -623,7 +687,7 @@ void udp_free(FAR struct udp_conn_s *conn)
   DEBUGASSERT(conn->crefs == 0);
 
   nxmutex_lock(&g_free_lock);
-  conn->lport = 0;
+  udp_setport(conn, 0);
 
   /* Remove the connection from the active list */
 
@@ -715,6 +779,50 @@ FAR struct udp_conn_s *udp_nextconn(FAR struct udp_conn_s *conn)
     }
 }
 
+/****************************************************************************
+ * Name: udp_setport
+ *
+ * Description:
+ *   Set (or clear with portno == 0) the local port of the connection.  All
+ *   changes of conn->lport must go through this function so that the
+ *   connection can be found by its port number.
+ *
+ ****************************************************************************/
+
+void udp_setport(FAR struct udp_conn_s *conn, uint16_t portno)
+{
+#ifdef CONFIG_NET_UDP_CONN_HASH
+  /* udp_connect() may be called without the network locked */
+
+  net_lock();
+  if (conn->lport != 0)
+    {
+      dq_rem(&conn->hnode, UDP_PORTHASH(conn->lport));
+    }
+
+  /* Keep the wildcard bindings behind those to a specific address, so
+   * that the first match found in a bucket is the most specific one.
+   */
+
+  if (portno != 0)
+    {
+      if (udp_iswildcard(conn))
+        {
+          dq_addlast(&conn->hnode, UDP_PORTHASH(portno));
+        }
+      else
+        {
+          dq_addfirst(&conn->hnode, UDP_PORTHASH(portno));
+        }
+    }
+
+  conn->lport = portno;
+  net_unlock();
+#else
+  conn->lport = portno;
+#endif
+}
+
 /****************************************************************************
  * Name: udp_bind
  *
@@ -852,7 +960,7 @@ int udp_bind(FAR struct udp_conn_s *conn, FAR const struct sockaddr *addr)
         }
       else
         {
-          conn->lport = portno;
+          udp_setport(conn, portno);
           ret         = OK;
         }
     }
@@ -877,7 +985,7 @@ int udp_bind(FAR struct udp_conn_s *conn, FAR const struct sockaddr *addr)
         {
           /* No.. then bind the socket to the port */
 
-          conn->lport = portno;
+          udp_setport(conn, portno);
           ret         = OK;
         }
       else
@@ -929,7 +1037,7 @@ int udp_connect(FAR struct udp_conn_s *conn, FAR const struct sockaddr *addr)
        * connection structure.
        */
 
-      conn->lport = HTONS(udp_select_port(conn->domain, &conn->u));
+      udp_setport(conn, HTONS(udp_select_port(conn->domain, &conn->u)));
       if (!conn->lport)
         {
           nerr("ERROR: Failed to get a local port!\n");
@@ -29,10 +29,99 @@
 
 #include "utils/utils.h"
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The value of a lone byte at an even or an odd address in the native
+ * 16-bit word holding it.
+ */
+
+#ifdef CONFIG_ENDIAN_BIG
+#  define CHKSUM_EVENBYTE(b) ((uint32_t)(b) << 8)
+#  define CHKSUM_ODDBYTE(b)  ((uint32_t)(b))
+#else
+#  define CHKSUM_EVENBYTE(b) ((uint32_t)(b))
+#  define CHKSUM_ODDBYTE(b)  ((uint32_t)(b) << 8)
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+#if !defined(CONFIG_NET_ARCH_CHKSUM) || defined(CONFIG_MM_IOB)
+
+/****************************************************************************
+ * Name: chksum_native
+ *
+ * Description:
+ *   Return the one's complement sum of the native 16-bit words holding the
+ *   memory region described by data and len, the words being aligned on
+ *   even addresses.  32-bit words are accumulated in 64 bits and folded
+ *   once at the end.
+ *
+ ****************************************************************************/
+
+static uint16_t chksum_native(FAR const uint8_t *data, size_t len)
+{
+  FAR const uint32_t *data32;
+  uint64_t acc = 0;
+
+  if (len > 0 && ((uintptr_t)data & 1) != 0)
+    {
+      acc += CHKSUM_ODDBYTE(*data);
+      data++;
+      len--;
+    }
+
+  if (len >= 2 && ((uintptr_t)data & 2) != 0)
+    {
+      acc += *(FAR const uint16_t *)data;
+      data += 2;
+      len  -= 2;
+    }
+
+  data32 = (FAR const uint32_t *)data;
+  while (len >= 16)
+    {
+      acc += data32[0];
+      acc += data32[1];
+      acc += data32[2];
+      acc += data32[3];
+      data32 += 4;
+      len    -= 16;
+    }
+
+  while (len >= 4)
+    {
+      acc += *data32++;
+      len -= 4;
+    }
+
+  data = (FAR const uint8_t *)data32;
+  if (len >= 2)
+    {
+      acc += *(FAR const uint16_t *)data;
+      data += 2;
+      len  -= 2;
+    }
+
+  if (len > 0)
+    {
+      acc += CHKSUM_EVENBYTE(*data);
+    }
+
+  /* Fold the carries back in */
+
+  acc = (acc >> 32) + (acc & 0xffffffff);
+  acc = (acc >> 32) + (acc & 0xffffffff);
+  acc = (acc >> 16) + (acc & 0xffff);
+  acc = (acc >> 16) + (acc & 0xffff);
+  acc = (acc >> 16) + (acc & 0xffff);
+
+  return (uint16_t)acc;
+}
+
 /****************************************************************************
  * Name: checksum
  *
@@ -53,62 +142,41 @@
  *
  ****************************************************************************/
 
-#ifndef CONFIG_NET_ARCH_CHKSUM
-uint16_t checksum(uint16_t sum, FAR const uint8_t *data,
-                    uint16_t len, bool *odd)
+static uint16_t checksum(uint16_t sum, FAR const uint8_t *data,
+                         uint16_t len, FAR bool *odd)
 {
-  FAR const uint8_t *dataptr;
-  FAR const uint8_t *last_byte;
-  uint16_t t;
+  uint16_t t = chksum_native(data, len);
 
-  dataptr = data;
-  last_byte = data + len - 1;
+  /* The sum is wanted over big-endian words starting at an even position
+   * of the stream.  Swapping the bytes of a one's complement sum is the
+   * same as swapping the bytes of each word, so the native sum is swapped
+   * once for each way it differs from that.
+   */
 
-  if (*odd == true)
+#ifdef CONFIG_ENDIAN_BIG
+  if ((((uintptr_t)data & 1) != 0) != *odd)
+#else
+  if ((((uintptr_t)data & 1) != 0) == *odd)
+#endif
     {
-      t = dataptr[0];
-      sum += t;
-      if (sum < t)
-        {
-          sum++; /* carry */
-        }
-
-      dataptr += 1;
+      t = (uint16_t)((t << 8) | (t >> 8));
     }
 
-  while (dataptr < last_byte)
+  sum += t;
+  if (sum < t)
     {
-      /* At least two more bytes */
-
-      t = ((uint16_t)dataptr[0] << 8) + dataptr[1];
-      sum += t;
-      if (sum < t)
-        {
-          sum++; /* carry */
-        }
-
-      dataptr += 2;
+      sum++; /* carry */
     }
 
-  *odd = false;
-
-  if (dataptr == last_byte)
-    {
-      t = (dataptr[0] << 8) + 0;
-      sum += t;
-      if (sum < t)
-        {
-          sum++; /* carry */
-        }
-
-      *odd = true;
-    }
+  *odd ^= (len & 1) != 0;
 
   /* Return sum in host byte order. */
 
   return sum;
 }
 
+#endif /* !CONFIG_NET_ARCH_CHKSUM || CONFIG_MM_IOB */
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -132,6 +200,7 @@ uint16_t checksum(uint16_t sum, FAR const uint8_t *data,
  *
  ****************************************************************************/
 
+#ifndef CONFIG_NET_ARCH_CHKSUM
 uint16_t chksum(uint16_t sum, FAR const uint8_t *data, uint16_t len)
 {
   bool odd = false;
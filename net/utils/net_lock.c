@@ -41,6 +41,7 @@
 #include <nuttx/net/net.h>
 
 #include "utils/utils.h"
+#include "local/local.h"
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -52,6 +53,18 @@
  * Private Data
  ****************************************************************************/
 
+/* The network lock still serializes the whole IP stack: the TCP and UDP
+ * connections, the network devices and their drivers' input paths.  Only
+ * the Unix domain sockets have a lock of their own (local_lock(), see
+ * net/local/local_conn.c), psock_lock() picks the right one for a socket.
+ *
+ * Lock order: the local lock may be taken with the network lock held, but
+ * the network lock is never taken with the local lock held.  The local
+ * socket code therefore releases the local lock before it duplicates or
+ * closes the files passed with SCM_RIGHTS, which may be sockets of other
+ * families (see local_sendctl(), local_recvctl() and local_closectl()).
+ */
+
 static rmutex_t g_netlock = NXRMUTEX_INITIALIZER;
 
 /****************************************************************************
@@ -211,6 +224,62 @@ int net_restorelock(unsigned int count)
   return nxrmutex_restorelock(&g_netlock, count);
 }
 
+/****************************************************************************
+ * Name: psock_lock
+ *
+ * Description:
+ *   Take the lock protecting the connection of the socket.  Unix domain
+ *   sockets have their own lock so that they do not contend with the rest
+ *   of the network stack.
+ *
+ * Input Parameters:
+ *   psock - The socket whose connection will be accessed
+ *
+ * Returned Value:
+ *   Zero (OK) is returned on success; a negated errno value is returned on
+ *   failured (probably -ECANCELED).
+ *
+ ****************************************************************************/
+
+int psock_lock(FAR struct socket *psock)
+{
+#ifdef CONFIG_NET_LOCAL
+  if (psock->s_domain == PF_LOCAL)
+    {
+      return local_lock();
+    }
+#endif
+
+  return net_lock();
+}
+
+/****************************************************************************
+ * Name: psock_unlock
+ *
+ * Description:
+ *   Release the lock taken by psock_lock().
+ *
+ * Input Parameters:
+ *   psock - The socket whose connection was accessed
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void psock_unlock(FAR struct socket *psock)
+{
+#ifdef CONFIG_NET_LOCAL
+  if (psock->s_domain == PF_LOCAL)
+    {
+      local_unlock();
+      return;
+    }
+#endif
+
+  net_unlock();
+}
+
 /****************************************************************************
  * Name: net_sem_timedwait
  *
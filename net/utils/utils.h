@@ -178,6 +178,20 @@ int net_breaklock(FAR unsigned int *count);
 
 int net_restorelock(unsigned int count);
 
+/****************************************************************************
+ * Name: psock_lock and psock_unlock
+ *
+ * Description:
+ *   Take and release the lock that protects the connection of a socket:
+ *   the local lock for Unix domain sockets, the network lock otherwise.
+ *
+ ****************************************************************************/
+
+struct socket;            /* Forward reference */
+
+int psock_lock(FAR struct socket *psock);
+void psock_unlock(FAR struct socket *psock);
+
 /****************************************************************************
  * Name: net_dsec2timeval
  *
@@ -318,6 +318,20 @@ void nxsched_remove_blocked(FAR struct tcb_s *btcb);
 int  nxsched_set_priority(FAR struct tcb_s *tcb, int sched_priority);
 bool nxsched_reprioritize_rtr(FAR struct tcb_s *tcb, int priority);
 
+/* Priority bitmap index of the ready-to-run list */
+
+#ifdef CONFIG_SCHED_READYTORUN_BITMAP
+bool nxsched_rtrmap_insert(FAR struct tcb_s *tcb);
+void nxsched_rtrmap_remove(FAR struct tcb_s *tcb);
+void nxsched_rtrmap_reprioritize(FAR struct tcb_s *tcb, int priority);
+void nxsched_rtrmap_reset(void);
+#  define nxsched_set_rtrpriority(tcb,priority) \
+     nxsched_rtrmap_reprioritize(tcb,priority)
+#else
+#  define nxsched_set_rtrpriority(tcb,priority) \
+     ((tcb)->sched_priority = (uint8_t)(priority))
+#endif
+
 /* Priority inheritance support */
 
 #ifdef CONFIG_PRIORITY_INHERITANCE
@@ -450,6 +464,15 @@ static inline_function bool nxsched_add_prioritized(FAR struct tcb_s *tcb,
 
   DEBUGASSERT(sched_priority >= SCHED_PRIORITY_MIN);
 
+#ifdef CONFIG_SCHED_READYTORUN_BITMAP
+  /* The ready-to-run list is indexed, there is no need to search it */
+
+  if (list == list_readytorun())
+    {
+      return nxsched_rtrmap_insert(tcb);
+    }
+#endif
+
   /* Search the list to find the location to insert the new Tcb.
    * Each is list is maintained in descending sched_priority order.
    */
@@ -517,6 +540,19 @@ static inline_function bool nxsched_add_prioritized(FAR struct tcb_s *tcb,
   return ret;
 }
 
+static inline_function void nxsched_remove_prioritized(FAR struct tcb_s *tcb,
+                                                       DSEG dq_queue_t *list)
+{
+#ifdef CONFIG_SCHED_READYTORUN_BITMAP
+  if (list == list_readytorun())
+    {
+      nxsched_rtrmap_remove(tcb);
+    }
+#endif
+
+  dq_rem((FAR dq_entry_t *)tcb, list);
+}
+
 #  ifdef CONFIG_SMP
 static inline_function int nxsched_select_cpu(cpu_set_t affinity)
 {
@@ -80,6 +80,25 @@ void nxsched_merge_prioritized(FAR dq_queue_t *list1, FAR dq_queue_t *list2,
 
   dq_move(list1, &clone);
 
+#ifdef CONFIG_SCHED_READYTORUN_BITMAP
+  if (list1 == list_readytorun())
+    {
+      nxsched_rtrmap_reset();
+    }
+  else if (list2 == list_readytorun())
+    {
+      /* The indexed list is merged into one TCB at a time */
+
+      while ((tmp = (FAR struct tcb_s *)dq_remfirst(&clone)) != NULL)
+        {
+          tmp->task_state = task_state;
+          nxsched_rtrmap_insert(tmp);
+        }
+
+      return;
+    }
+#endif
+
   /* Get the TCB at the head of list1 */
 
   tcb1 = (FAR struct tcb_s *)dq_peek(&clone);
@@ -0,0 +1,246 @@
+/****************************************************************************
+ * sched/sched/sched_readytorunmap.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <strings.h>
+#include <assert.h>
+
+#include <nuttx/queue.h>
+
+#include "sched/sched.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define RTRMAP_NPRIOS  (SCHED_PRIORITY_MAX + 1)
+#define RTRMAP_NWORDS  ((RTRMAP_NPRIOS + 31) >> 5)
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The g_readytorun list is left as it is, sorted by priority, so that its
+ * head and the walks over it still work.  It is indexed by a bitmap of the
+ * priorities present in the list and by the last TCB of each of these
+ * priorities, which is where a new TCB of that priority is added.
+ *
+ * The IDLE task at the end of the list is never indexed: nothing can be
+ * added after it.
+ */
+
+static uint32_t g_rtrmap_bitmap[RTRMAP_NWORDS];
+static FAR struct tcb_s *g_rtrmap_tail[RTRMAP_NPRIOS];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxsched_rtrmap_above
+ *
+ * Description:
+ *   Return the lowest priority present in the g_readytorun list that is
+ *   higher than or equal to the given priority, or -1 if there is none.
+ *   This looks at no more than RTRMAP_NWORDS words of the bitmap.
+ *
+ ****************************************************************************/
+
+static int nxsched_rtrmap_above(int priority)
+{
+  int ndx = priority >> 5;
+  uint32_t word;
+
+  word = g_rtrmap_bitmap[ndx] & (UINT32_MAX << (priority & 31));
+  while (word == 0)
+    {
+      if (++ndx >= RTRMAP_NWORDS)
+        {
+          return -1;
+        }
+
+      word = g_rtrmap_bitmap[ndx];
+    }
+
+  return (ndx << 5) + ffs((int)word) - 1;
+}
+
+/****************************************************************************
+ * Name: nxsched_rtrmap_settail
+ *
+ * Description:
+ *   Make the TCB the last one of its priority in the index.
+ *
+ ****************************************************************************/
+
+static inline void nxsched_rtrmap_settail(FAR struct tcb_s *tcb)
+{
+  int priority = tcb->sched_priority;
+
+  g_rtrmap_tail[priority] = tcb;
+  g_rtrmap_bitmap[priority >> 5] |= (uint32_t)1 << (priority & 31);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxsched_rtrmap_insert
+ *
+ * Description:
+ *   Add a TCB to the g_readytorun list behind the other TCBs of the same
+ *   or of a higher priority, without walking the list.
+ *
+ * Input Parameters:
+ *   tcb - Points to the TCB to add
+ *
+ * Returned Value:
+ *   true if the TCB was added at the head of the list.
+ *
+ * Assumptions:
+ * - The caller has established a critical section.
+ *
+ ****************************************************************************/
+
+bool nxsched_rtrmap_insert(FAR struct tcb_s *tcb)
+{
+  FAR dq_queue_t *list = list_readytorun();
+  FAR struct tcb_s *prev;
+  int priority;
+
+  priority = nxsched_rtrmap_above(tcb->sched_priority);
+  if (priority < 0)
+    {
+      /* Nothing of the same or of a higher priority is in the list */
+
+      dq_addfirst((FAR dq_entry_t *)tcb, list);
+      nxsched_rtrmap_settail(tcb);
+      return true;
+    }
+
+  prev = g_rtrmap_tail[priority];
+  dq_addafter((FAR dq_entry_t *)prev, (FAR dq_entry_t *)tcb, list);
+  nxsched_rtrmap_settail(tcb);
+  return false;
+}
+
+/****************************************************************************
+ * Name: nxsched_rtrmap_remove
+ *
+ * Description:
+ *   Remove a TCB from the index before it is removed from the g_readytorun
+ *   list.
+ *
+ * Input Parameters:
+ *   tcb - Points to the TCB that is still in the g_readytorun list
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void nxsched_rtrmap_remove(FAR struct tcb_s *tcb)
+{
+  int priority = tcb->sched_priority;
+  FAR struct tcb_s *prev;
+
+  if (g_rtrmap_tail[priority] != tcb)
+    {
+      return;
+    }
+
+  prev = tcb->blink;
+  if (prev != NULL && prev->sched_priority == priority)
+    {
+      g_rtrmap_tail[priority] = prev;
+    }
+  else
+    {
+      g_rtrmap_tail[priority] = NULL;
+      g_rtrmap_bitmap[priority >> 5] &= ~((uint32_t)1 << (priority & 31));
+    }
+}
+
+/****************************************************************************
+ * Name: nxsched_rtrmap_reprioritize
+ *
+ * Description:
+ *   Change the priority of a TCB in the g_readytorun list without moving
+ *   it.  The caller must assure that the list stays sorted.
+ *
+ * Input Parameters:
+ *   tcb - Points to the TCB to reprioritize
+ *   priority - The new priority
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void nxsched_rtrmap_reprioritize(FAR struct tcb_s *tcb, int priority)
+{
+  FAR struct tcb_s *next;
+
+#ifdef CONFIG_SMP
+  if (tcb->task_state != TSTATE_TASK_READYTORUN)
+#else
+  if (!TLIST_ISRUNNABLE(tcb->task_state))
+#endif
+    {
+      /* Not in the g_readytorun list */
+
+      tcb->sched_priority = (uint8_t)priority;
+      return;
+    }
+
+  nxsched_rtrmap_remove(tcb);
+  tcb->sched_priority = (uint8_t)priority;
+
+  next = tcb->flink;
+  if (next == NULL || next->sched_priority != priority)
+    {
+      nxsched_rtrmap_settail(tcb);
+    }
+}
+
+/****************************************************************************
+ * Name: nxsched_rtrmap_reset
+ *
+ * Description:
+ *   Forget the index after the g_readytorun list was emptied.
+ *
+ ****************************************************************************/
+
+void nxsched_rtrmap_reset(void)
+{
+  memset(g_rtrmap_bitmap, 0, sizeof(g_rtrmap_bitmap));
+  memset(g_rtrmap_tail, 0, sizeof(g_rtrmap_tail));
+}
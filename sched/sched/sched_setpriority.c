@@ -216,7 +216,7 @@ static inline void nxsched_running_setpriority(FAR struct tcb_s *tcb,
 
           /* Change the task priority */
 
-          tcb->sched_priority = (uint8_t)sched_priority;
+          nxsched_set_rtrpriority(tcb, sched_priority);
         }
       else
         {
@@ -262,7 +262,7 @@ static inline void nxsched_running_setpriority(FAR struct tcb_s *tcb,
     {
       /* Change the task priority */
 
-      tcb->sched_priority = (uint8_t)sched_priority;
+      nxsched_set_rtrpriority(tcb, sched_priority);
     }
 }
 
@@ -80,11 +80,9 @@ int wd_cancel(FAR struct wdog_s *wdog)
    * cancellation is complete
    */
 
-  head = list_is_head(&g_wdactivelist, &wdog->node);
-
   /* Now, remove the watchdog from the timer queue */
 
-  list_delete(&wdog->node);
+  head = wd_queue_remove(wdog);
 
   /* Mark the watchdog inactive */
 
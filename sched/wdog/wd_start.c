@@ -163,21 +163,8 @@ static inline_function void wd_expiration(clock_t ticks)
    * other watchdogs that became ready to run at this time
    */
 
-  while (!list_is_empty(&g_wdactivelist))
+  while ((wdog = wd_queue_expired(ticks)) != NULL)
     {
-      wdog = list_first_entry(&g_wdactivelist, struct wdog_s, node);
-
-      /* Check if expected time is expired */
-
-      if (!clock_compare(wdog->expired, ticks))
-        {
-          break;
-        }
-
-      /* Remove the watchdog from the head of the list */
-
-      list_delete(&wdog->node);
-
       /* Indicate that the watchdog is no longer active. */
 
       func = wdog->func;
@@ -209,8 +196,8 @@ static inline_function void wd_expiration(clock_t ticks)
  * Name: wd_insert
  *
  * Description:
- *   Insert the timer into the global list to ensure that
- *   the list is sorted in increasing order of expiration absolute time.
+ *   Insert the timer into the active timer queue, which is kept in
+ *   increasing order of expiration absolute time.
  *
  * Input Parameters:
  *   wdog     - Watchdog ID
@@ -230,32 +217,6 @@ static inline_function
 bool wd_insert(FAR struct wdog_s *wdog, clock_t expired,
                wdentry_t wdentry, wdparm_t arg)
 {
-  FAR struct wdog_s *curr;
-  FAR struct wdog_s *head;
-
-  /* Traverse the watchdog list */
-
-  head = list_first_entry(&g_wdactivelist, struct wdog_s, node);
-
-  list_for_every_entry(&g_wdactivelist, curr, struct wdog_s, node)
-    {
-      /* Until curr->expired has not timed out relative to expired */
-
-      if (!clock_compare(curr->expired, expired))
-        {
-          break;
-        }
-    }
-
-  /* There are two cases:
-   * - Traverse to the end, where curr == &g_wdactivelist.
-   * - Find a curr such that curr->expected has not timed out
-   * relative to expired.
-   * In either case 1 or 2, we just insert the wdog before curr.
-   */
-
-  list_add_before(&curr->node, &wdog->node);
-
   wdog->func = wdentry;
   up_getpicbase(&wdog->picbase);
   wdog->arg = arg;
@@ -263,7 +224,7 @@ bool wd_insert(FAR struct wdog_s *wdog, clock_t expired,
 
   /* Return whether the head of the watchdog list has changed. */
 
-  return head == curr;
+  return wd_queue_insert(wdog);
 }
 
 /****************************************************************************
@@ -330,8 +291,7 @@ int wd_start_abstick(FAR struct wdog_s *wdog, clock_t ticks,
 
   if (WDOG_ISACTIVE(wdog))
     {
-      reassess |= list_is_head(&g_wdactivelist, &wdog->node);
-      list_delete(&wdog->node);
+      reassess |= wd_queue_remove(wdog);
       wdog->func = NULL;
     }
 
@@ -358,7 +318,7 @@ int wd_start_abstick(FAR struct wdog_s *wdog, clock_t ticks,
 
   if (WDOG_ISACTIVE(wdog))
     {
-      list_delete(&wdog->node);
+      wd_queue_remove(wdog);
       wdog->func = NULL;
     }
 
@@ -487,8 +447,8 @@ int wd_start_period(FAR struct wdog_period_s *wdog, sclock_t delay,
 #ifdef CONFIG_SCHED_TICKLESS
 clock_t wd_timer(clock_t ticks, bool noswitches)
 {
-  FAR struct wdog_s *wdog;
   irqstate_t flags;
+  clock_t next;
   sclock_t ret;
 
   /* Check if the watchdog at the head of the list is ready to run */
@@ -502,7 +462,7 @@ clock_t wd_timer(clock_t ticks, bool noswitches)
 
   /* Return the delay for the next watchdog to expire */
 
-  if (list_is_empty(&g_wdactivelist))
+  if (!wd_queue_next(&next))
     {
       spin_unlock_irqrestore(&g_wdspinlock, flags);
       return 0;
@@ -512,8 +472,7 @@ clock_t wd_timer(clock_t ticks, bool noswitches)
    * may get negative value.
    */
 
-  wdog = list_first_entry(&g_wdactivelist, struct wdog_s, node);
-  ret = wdog->expired - ticks;
+  ret = next - ticks;
 
   spin_unlock_irqrestore(&g_wdspinlock, flags);
 
@@ -0,0 +1,569 @@
+/****************************************************************************
+ * sched/wdog/wd_wheel.c
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <strings.h>
+#include <assert.h>
+
+#include <nuttx/clock.h>
+#include <nuttx/list.h>
+#include <nuttx/wdog.h>
+
+#include "wdog/wdog.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Each level of the wheel has 64 slots so that the non-empty slots of one
+ * level can be tracked in a single 64-bit bitmap.
+ */
+
+#define WHEEL_BITS         6
+#define WHEEL_SLOTS        (1 << WHEEL_BITS)
+#define WHEEL_MASK         (WHEEL_SLOTS - 1)
+#define WHEEL_LEVELS       CONFIG_WDOG_TIMER_WHEEL_LEVELS
+
+#define WHEEL_SHIFT(l)     ((l) * WHEEL_BITS)
+#define WHEEL_INDEX(t, l)  ((unsigned int)((t) >> WHEEL_SHIFT(l)) & WHEEL_MASK)
+#define WHEEL_RANGE        ((clock_t)1 << WHEEL_SHIFT(WHEEL_LEVELS))
+
+#define WHEEL_BIT(i)       (UINT64_C(1) << (i))
+
+/* True if the tick 'a' is strictly before the tick 'b' */
+
+#define WHEEL_BEFORE(a, b) ((sclock_t)((a) - (b)) < 0)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* The watchdog timer wheel.
+ *
+ * A watchdog that expires less than 64^(L + 1) ticks after 'curr' lives in
+ * level L, in the slot selected by bits [6L, 6L + 6) of its expiration
+ * time.  A level 0 slot therefore holds watchdogs with one exact expiration
+ * time, and a level L slot holds a block of 64^L ticks that is moved down
+ * ("cascaded") to the lower levels when 'curr' reaches the start of the
+ * block.  Watchdogs beyond the range of the wheel are kept on the unsorted
+ * overflow list, and watchdogs started with an expiration time that the
+ * wheel has already passed are kept on the expired list.
+ *
+ * The list head of a slot is only valid while the corresponding bit is set
+ * in 'bitmap', so the slots need no initialization.
+ */
+
+struct wdog_wheel_s
+{
+  struct list_node expired;                /* Watchdogs started late */
+  struct list_node overflow;               /* Watchdogs beyond the wheel */
+  clock_t          curr;                   /* Next tick to be processed */
+  clock_t          ovfnext;                /* Lower bound of the overflow
+                                            * expiration times */
+  clock_t          next;                   /* First expiration time */
+  bool             valid;                  /* 'next' is up to date */
+  uint64_t         bitmap[WHEEL_LEVELS];   /* Non-empty slots */
+  struct list_node slot[WHEEL_LEVELS][WHEEL_SLOTS];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct wdog_wheel_s g_wdwheel =
+{
+  LIST_INITIAL_VALUE(g_wdwheel.expired),
+  LIST_INITIAL_VALUE(g_wdwheel.overflow),
+  INITIAL_SYSTEM_TIMER_TICKS
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: wd_wheel_rotate
+ *
+ * Description:
+ *   Return the index of the first non-empty slot of a level, searching
+ *   from the slot 'start' upward and wrapping around.
+ *
+ ****************************************************************************/
+
+static inline_function unsigned int wd_wheel_rotate(uint64_t map,
+                                                    unsigned int start)
+{
+  start &= WHEEL_MASK;
+  map = (map >> start) | (map << ((WHEEL_SLOTS - start) & WHEEL_MASK));
+  return (start + ffsll(map) - 1) & WHEEL_MASK;
+}
+
+/****************************************************************************
+ * Name: wd_wheel_add
+ *
+ * Description:
+ *   Place the watchdog in the slot that matches its expiration time
+ *   relative to the current wheel time.
+ *
+ ****************************************************************************/
+
+static void wd_wheel_add(FAR struct wdog_s *wdog)
+{
+  FAR struct list_node *list;
+  clock_t expired = wdog->expired;
+  clock_t delta = expired - g_wdwheel.curr;
+  unsigned int level;
+  unsigned int index;
+
+  if ((sclock_t)delta < 0)
+    {
+      list_add_tail(&g_wdwheel.expired, &wdog->node);
+      return;
+    }
+
+  for (level = 0; level < WHEEL_LEVELS; level++)
+    {
+      if ((delta >> WHEEL_SHIFT(level + 1)) == 0)
+        {
+          index = WHEEL_INDEX(expired, level);
+          list  = &g_wdwheel.slot[level][index];
+
+          if ((g_wdwheel.bitmap[level] & WHEEL_BIT(index)) == 0)
+            {
+              g_wdwheel.bitmap[level] |= WHEEL_BIT(index);
+              list_initialize(list);
+            }
+
+          list_add_tail(list, &wdog->node);
+          return;
+        }
+    }
+
+  if (list_is_empty(&g_wdwheel.overflow) ||
+      WHEEL_BEFORE(wdog->expired, g_wdwheel.ovfnext))
+    {
+      g_wdwheel.ovfnext = wdog->expired;
+    }
+
+  list_add_tail(&g_wdwheel.overflow, &wdog->node);
+}
+
+/****************************************************************************
+ * Name: wd_wheel_del
+ *
+ * Description:
+ *   Remove the watchdog from its slot and update the slot bitmap.
+ *
+ ****************************************************************************/
+
+static void wd_wheel_del(FAR struct wdog_s *wdog)
+{
+  FAR struct list_node *list = wdog->node.prev;
+  bool last = wdog->node.prev == wdog->node.next;
+  ptrdiff_t index;
+
+  list_delete(&wdog->node);
+
+  /* If the watchdog was the only one in its list, then 'list' is the list
+   * head.  Mark the slot empty unless it is one of the other lists.
+   */
+
+  if (last && list != &g_wdwheel.overflow && list != &g_wdwheel.expired)
+    {
+      index = list - &g_wdwheel.slot[0][0];
+      g_wdwheel.bitmap[index / WHEEL_SLOTS] &=
+        ~WHEEL_BIT(index % WHEEL_SLOTS);
+    }
+}
+
+/****************************************************************************
+ * Name: wd_wheel_cascade
+ *
+ * Description:
+ *   Move the watchdogs of one slot to the lower levels.  This is done when
+ *   the wheel time reaches the start of the block covered by the slot.
+ *
+ ****************************************************************************/
+
+static void wd_wheel_cascade(unsigned int level, unsigned int index)
+{
+  FAR struct list_node *list = &g_wdwheel.slot[level][index];
+  FAR struct wdog_s *wdog;
+  FAR struct wdog_s *tmp;
+
+  if ((g_wdwheel.bitmap[level] & WHEEL_BIT(index)) == 0)
+    {
+      return;
+    }
+
+  /* All watchdogs of the slot now expire within 64^level ticks, so none
+   * of them can be added back to this slot.
+   */
+
+  g_wdwheel.bitmap[level] &= ~WHEEL_BIT(index);
+
+  list_for_every_entry_safe(list, wdog, tmp, struct wdog_s, node)
+    {
+      list_delete(&wdog->node);
+      wd_wheel_add(wdog);
+    }
+}
+
+/****************************************************************************
+ * Name: wd_wheel_pull
+ *
+ * Description:
+ *   Move the watchdogs that have come within the range of the wheel from
+ *   the overflow list into the wheel.
+ *
+ ****************************************************************************/
+
+static void wd_wheel_pull(void)
+{
+  FAR struct wdog_s *wdog;
+  FAR struct wdog_s *tmp;
+  bool found = false;
+
+  list_for_every_entry_safe(&g_wdwheel.overflow, wdog, tmp,
+                            struct wdog_s, node)
+    {
+      if ((sclock_t)(wdog->expired - g_wdwheel.curr) <
+          (sclock_t)WHEEL_RANGE)
+        {
+          list_delete(&wdog->node);
+          wd_wheel_add(wdog);
+        }
+      else if (!found || WHEEL_BEFORE(wdog->expired, g_wdwheel.ovfnext))
+        {
+          g_wdwheel.ovfnext = wdog->expired;
+          found = true;
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: wd_wheel_advance
+ *
+ * Description:
+ *   Advance the wheel time to the next tick, no later than ticks + 1, at
+ *   which a non-empty slot has to be processed, skipping all empty slots in
+ *   between.  Then cascade the higher level slots that start at the new
+ *   wheel time.
+ *
+ ****************************************************************************/
+
+static void wd_wheel_advance(clock_t ticks)
+{
+  clock_t curr = g_wdwheel.curr;
+  clock_t delta = ticks + 1 - curr;
+  clock_t block;
+  clock_t step;
+  unsigned int level;
+  unsigned int index;
+
+  for (level = 0; level < WHEEL_LEVELS; level++)
+    {
+      if (g_wdwheel.bitmap[level] == 0)
+        {
+          continue;
+        }
+
+      /* The slot of the current block has already been processed, so a
+       * non-empty slot at 'index' starts 1 to 64 blocks from now.
+       */
+
+      index = WHEEL_INDEX(curr, level);
+      block = (curr >> WHEEL_SHIFT(level)) + 1 +
+              ((wd_wheel_rotate(g_wdwheel.bitmap[level], index + 1) -
+                index - 1) & WHEEL_MASK);
+      step  = (block << WHEEL_SHIFT(level)) - curr;
+
+      if (step < delta)
+        {
+          delta = step;
+        }
+    }
+
+  if (!list_is_empty(&g_wdwheel.overflow))
+    {
+      step = g_wdwheel.ovfnext - (WHEEL_RANGE - 1) - curr;
+      if (step < delta)
+        {
+          delta = step;
+        }
+    }
+
+  curr += delta;
+  g_wdwheel.curr = curr;
+
+  for (level = 1; level < WHEEL_LEVELS; level++)
+    {
+      if ((curr & (((clock_t)1 << WHEEL_SHIFT(level)) - 1)) != 0)
+        {
+          break;
+        }
+
+      wd_wheel_cascade(level, WHEEL_INDEX(curr, level));
+    }
+}
+
+/****************************************************************************
+ * Name: wd_wheel_first
+ *
+ * Description:
+ *   Search the wheel for the first expiration time.  Only the first
+ *   non-empty slot of each level needs to be examined.
+ *
+ ****************************************************************************/
+
+static bool wd_wheel_first(FAR clock_t *next)
+{
+  FAR struct list_node *list;
+  FAR struct wdog_s *wdog;
+  unsigned int level;
+  unsigned int index;
+  bool found = false;
+
+  list_for_every_entry(&g_wdwheel.expired, wdog, struct wdog_s, node)
+    {
+      if (!found || WHEEL_BEFORE(wdog->expired, *next))
+        {
+          *next = wdog->expired;
+          found = true;
+        }
+    }
+
+  for (level = 0; level < WHEEL_LEVELS; level++)
+    {
+      if (g_wdwheel.bitmap[level] == 0)
+        {
+          continue;
+        }
+
+      /* Level 0 starts at the current slot.  The current slot of the other
+       * levels holds the block that is 64 blocks away.
+       */
+
+      index = WHEEL_INDEX(g_wdwheel.curr, level);
+      index = wd_wheel_rotate(g_wdwheel.bitmap[level],
+                              level == 0 ? index : index + 1);
+      list  = &g_wdwheel.slot[level][index];
+
+      list_for_every_entry(list, wdog, struct wdog_s, node)
+        {
+          if (!found || WHEEL_BEFORE(wdog->expired, *next))
+            {
+              *next = wdog->expired;
+              found = true;
+            }
+        }
+    }
+
+  /* ovfnext may be earlier than the real first overflow expiration after a
+   * cancellation.  That only causes an early timer event.
+   */
+
+  if (!list_is_empty(&g_wdwheel.overflow) &&
+      (!found || WHEEL_BEFORE(g_wdwheel.ovfnext, *next)))
+    {
+      *next = g_wdwheel.ovfnext;
+      found = true;
+    }
+
+  return found;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: wd_queue_insert
+ *
+ * Description:
+ *   Add the watchdog to the timer wheel according to its expiration time.
+ *
+ * Input Parameters:
+ *   wdog - The watchdog to be added.
+ *
+ * Returned Value:
+ *   True if the watchdog has become the first one to expire.
+ *
+ * Assumptions:
+ *   g_wdspinlock is held.
+ *
+ ****************************************************************************/
+
+bool wd_queue_insert(FAR struct wdog_s *wdog)
+{
+  bool first;
+
+  if (!g_wdwheel.valid)
+    {
+      g_wdwheel.valid = wd_wheel_first(&g_wdwheel.next);
+    }
+
+  first = !g_wdwheel.valid || WHEEL_BEFORE(wdog->expired, g_wdwheel.next);
+
+  wd_wheel_add(wdog);
+
+  if (first)
+    {
+      g_wdwheel.next  = wdog->expired;
+      g_wdwheel.valid = true;
+    }
+
+  return first;
+}
+
+/****************************************************************************
+ * Name: wd_queue_remove
+ *
+ * Description:
+ *   Remove the watchdog from the timer wheel.
+ *
+ * Input Parameters:
+ *   wdog - The watchdog to be removed.
+ *
+ * Returned Value:
+ *   True if the watchdog may have been the first one to expire.
+ *
+ * Assumptions:
+ *   g_wdspinlock is held.
+ *
+ ****************************************************************************/
+
+bool wd_queue_remove(FAR struct wdog_s *wdog)
+{
+  bool first = !g_wdwheel.valid || wdog->expired == g_wdwheel.next;
+
+  wd_wheel_del(wdog);
+
+  /* The first expiration time is searched again when it is needed */
+
+  if (first)
+    {
+      g_wdwheel.valid = false;
+    }
+
+  return first;
+}
+
+/****************************************************************************
+ * Name: wd_queue_expired
+ *
+ * Description:
+ *   Advance the timer wheel up to 'ticks' and remove one watchdog that has
+ *   expired.
+ *
+ * Input Parameters:
+ *   ticks - The current time in clock ticks.
+ *
+ * Returned Value:
+ *   The expired watchdog or NULL if no more watchdogs have expired.
+ *
+ * Assumptions:
+ *   g_wdspinlock is held.
+ *
+ ****************************************************************************/
+
+FAR struct wdog_s *wd_queue_expired(clock_t ticks)
+{
+  FAR struct wdog_s *wdog;
+  unsigned int index;
+
+  /* Watchdogs started after the wheel has passed their expiration time */
+
+  if (!list_is_empty(&g_wdwheel.expired))
+    {
+      wdog = list_first_entry(&g_wdwheel.expired, struct wdog_s, node);
+      if (clock_compare(wdog->expired, ticks))
+        {
+          wd_queue_remove(wdog);
+          return wdog;
+        }
+    }
+
+  for (; ; )
+    {
+      if (!list_is_empty(&g_wdwheel.overflow) &&
+          (sclock_t)(g_wdwheel.ovfnext - g_wdwheel.curr) <
+          (sclock_t)WHEEL_RANGE)
+        {
+          wd_wheel_pull();
+        }
+
+      if (!clock_compare(g_wdwheel.curr, ticks))
+        {
+          return NULL;
+        }
+
+      /* All watchdogs in the current level 0 slot have expired */
+
+      index = WHEEL_INDEX(g_wdwheel.curr, 0);
+      if ((g_wdwheel.bitmap[0] & WHEEL_BIT(index)) != 0)
+        {
+          wdog = list_first_entry(&g_wdwheel.slot[0][index],
+                                  struct wdog_s, node);
+          wd_queue_remove(wdog);
+          return wdog;
+        }
+
+      wd_wheel_advance(ticks);
+    }
+}
+
+/****************************************************************************
+ * Name: wd_queue_next
+ *
+ * Description:
+ *   Get the expiration time of the first watchdog to expire.
+ *
+ * Input Parameters:
+ *   next - The location to return the expiration time.
+ *
+ * Returned Value:
+ *   False if there is no active watchdog.
+ *
+ * Assumptions:
+ *   g_wdspinlock is held.
+ *
+ ****************************************************************************/
+
+bool wd_queue_next(FAR clock_t *next)
+{
+  if (!g_wdwheel.valid)
+    {
+      g_wdwheel.valid = wd_wheel_first(&g_wdwheel.next);
+    }
+
+  *next = g_wdwheel.next;
+  return g_wdwheel.valid;
+}
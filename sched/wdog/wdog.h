@@ -59,12 +59,15 @@ extern "C"
 #define EXTERN extern
 #endif
 
+#ifndef CONFIG_WDOG_TIMER_WHEEL
 /* The g_wdactivelist data structure is a singly linked list ordered by
  * watchdog expiration time. When watchdog timers expire,the functions on
  * this linked list are removed and the function is called.
  */
 
 extern struct list_node g_wdactivelist;
+#endif
+
 extern spinlock_t g_wdspinlock;
 
 /****************************************************************************
@@ -103,6 +106,100 @@ clock_t wd_timer(clock_t ticks, bool noswitches);
 void wd_timer(clock_t ticks);
 #endif
 
+/* The active timer queue.  It is either the sorted g_wdactivelist or,
+ * with CONFIG_WDOG_TIMER_WHEEL, the hierarchical timer wheel implemented
+ * in wd_wheel.c.  All operations must be called with g_wdspinlock held:
+ *
+ *   wd_queue_insert  - Add a watchdog according to wdog->expired.  Returns
+ *                      true if it became the first watchdog to expire.
+ *   wd_queue_remove  - Remove an active watchdog.  Returns true if it was
+ *                      the first watchdog to expire.
+ *   wd_queue_expired - Remove and return one watchdog that has expired at
+ *                      'ticks', or NULL if there is none.
+ *   wd_queue_next    - Return the expiration time of the first watchdog to
+ *                      expire.  Returns false if the queue is empty.
+ */
+
+#ifdef CONFIG_WDOG_TIMER_WHEEL
+bool wd_queue_insert(FAR struct wdog_s *wdog);
+bool wd_queue_remove(FAR struct wdog_s *wdog);
+FAR struct wdog_s *wd_queue_expired(clock_t ticks);
+bool wd_queue_next(FAR clock_t *next);
+#else
+static inline_function bool wd_queue_insert(FAR struct wdog_s *wdog)
+{
+  FAR struct wdog_s *curr;
+  FAR struct wdog_s *head;
+
+  /* Traverse the watchdog list */
+
+  head = list_first_entry(&g_wdactivelist, struct wdog_s, node);
+
+  list_for_every_entry(&g_wdactivelist, curr, struct wdog_s, node)
+    {
+      /* Until curr->expired has not timed out relative to expired */
+
+      if (!clock_compare(curr->expired, wdog->expired))
+        {
+          break;
+        }
+    }
+
+  /* There are two cases:
+   * - Traverse to the end, where curr == &g_wdactivelist.
+   * - Find a curr such that curr->expected has not timed out
+   * relative to expired.
+   * In either case 1 or 2, we just insert the wdog before curr.
+   */
+
+  list_add_before(&curr->node, &wdog->node);
+
+  /* Return whether the head of the watchdog list has changed. */
+
+  return head == curr;
+}
+
+static inline_function bool wd_queue_remove(FAR struct wdog_s *wdog)
+{
+  bool head = list_is_head(&g_wdactivelist, &wdog->node);
+
+  list_delete(&wdog->node);
+  return head;
+}
+
+static inline_function FAR struct wdog_s *wd_queue_expired(clock_t ticks)
+{
+  FAR struct wdog_s *wdog;
+
+  if (list_is_empty(&g_wdactivelist))
+    {
+      return NULL;
+    }
+
+  /* Check if the watchdog at the head of the list has expired */
+
+  wdog = list_first_entry(&g_wdactivelist, struct wdog_s, node);
+  if (!clock_compare(wdog->expired, ticks))
+    {
+      return NULL;
+    }
+
+  list_delete(&wdog->node);
+  return wdog;
+}
+
+static inline_function bool wd_queue_next(FAR clock_t *next)
+{
+  if (list_is_empty(&g_wdactivelist))
+    {
+      return false;
+    }
+
+  *next = list_first_entry(&g_wdactivelist, struct wdog_s, node)->expired;
+  return true;
+}
+#endif
+
 /****************************************************************************
  * Name: wd_recover
  *
@@ -45,6 +45,7 @@
 static int work_qcancel(FAR struct kwork_wqueue_s *wqueue, bool sync,
                         FAR struct work_s *work)
 {
+  FAR struct kworker_s *kworker;
   irqstate_t flags;
   FAR sem_t *sync_wait = NULL;
 
@@ -56,9 +57,10 @@ static int work_qcancel(FAR struct kwork_wqueue_s *wqueue, bool sync,
   /* Cancelling the work is simply a matter of removing the work structure
    * from the work queue.  This must be done with interrupts disabled because
    * new work is typically added to the work queue from interrupt handlers.
+   * With per-CPU queues, the lock is that of the queue owning the work.
    */
 
-  flags = spin_lock_irqsave(&wqueue->lock);
+  flags = work_lock_queue(&wqueue, work, false);
 
   if (!work_available(work))
     {
@@ -78,20 +80,13 @@ static int work_qcancel(FAR struct kwork_wqueue_s *wqueue, bool sync,
 
   if (sync)
     {
-      int wndx;
-      pid_t pid = nxsched_gettid();
-
       /* Wait until the worker thread finished the work. */
 
-      for (wndx = 0; wndx < wqueue->nthreads; wndx++)
+      kworker = work_get_worker(wqueue, work, nxsched_gettid());
+      if (kworker != NULL)
         {
-          if (wqueue->worker[wndx].work == work &&
-              wqueue->worker[wndx].pid != pid)
-            {
-              wqueue->worker[wndx].wait_count++;
-              sync_wait = &wqueue->worker[wndx].wait;
-              break;
-            }
+          kworker->wait_count++;
+          sync_wait = &kworker->wait;
         }
     }
 
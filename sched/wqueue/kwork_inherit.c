@@ -208,6 +208,7 @@ static void lpwork_restoreworker(pid_t wpid, uint8_t reqprio)
 
 void lpwork_boostpriority(uint8_t reqprio)
 {
+  FAR struct kwork_wqueue_s *wqueue = &g_lpwork.wq;
   irqstate_t flags;
   int wndx;
 
@@ -222,12 +223,18 @@ void lpwork_boostpriority(uint8_t reqprio)
 
   flags = enter_critical_section();
 
-  /* Adjust the priority of every worker thread */
+  /* Adjust the priority of every worker thread, on every per-CPU queue */
 
-  for (wndx = 0; wndx < CONFIG_SCHED_LPNTHREADS; wndx++)
+  do
     {
-      lpwork_boostworker(g_lpwork.worker[wndx].pid, reqprio);
+      for (wndx = 0; wndx < wqueue->nthreads; wndx++)
+        {
+          lpwork_boostworker(wqueue->worker[wndx].pid, reqprio);
+        }
+
+      wqueue = work_next(wqueue);
     }
+  while (wqueue != NULL && wqueue != &g_lpwork.wq);
 
   leave_critical_section(flags);
 }
@@ -252,6 +259,7 @@ void lpwork_boostpriority(uint8_t reqprio)
 
 void lpwork_restorepriority(uint8_t reqprio)
 {
+  FAR struct kwork_wqueue_s *wqueue = &g_lpwork.wq;
   irqstate_t flags;
   int wndx;
 
@@ -266,12 +274,18 @@ void lpwork_restorepriority(uint8_t reqprio)
 
   flags = enter_critical_section();
 
-  /* Adjust the priority of every worker thread */
+  /* Adjust the priority of every worker thread, on every per-CPU queue */
 
-  for (wndx = 0; wndx < CONFIG_SCHED_LPNTHREADS; wndx++)
+  do
     {
-      lpwork_restoreworker(g_lpwork.worker[wndx].pid, reqprio);
+      for (wndx = 0; wndx < wqueue->nthreads; wndx++)
+        {
+          lpwork_restoreworker(wqueue->worker[wndx].pid, reqprio);
+        }
+
+      wqueue = work_next(wqueue);
     }
+  while (wqueue != NULL && wqueue != &g_lpwork.wq);
 
   leave_critical_section(flags);
 }
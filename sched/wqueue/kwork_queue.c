@@ -91,10 +91,11 @@ int work_queue_period_wq(FAR struct kwork_wqueue_s *wqueue,
   expected = clock_delay2abstick(delay);
 
   /* Interrupts are disabled so that this logic can be called from with
-   * task logic or from interrupt handling logic.
+   * task logic or from interrupt handling logic.  This also selects the
+   * per-CPU queue that the work is added to.
    */
 
-  flags = spin_lock_irqsave(&wqueue->lock);
+  flags = work_lock_queue(&wqueue, work, true);
 
   /* Ensure the work has been removed. */
 
@@ -138,7 +139,7 @@ int work_queue_period_wq(FAR struct kwork_wqueue_s *wqueue,
     {
       /* Immediately wake up the worker thread. */
 
-      nxsem_post(&wqueue->sem);
+      work_wakeup(wqueue);
     }
 
   return 0;
@@ -89,10 +89,14 @@ struct hp_wqueue_s g_hpwork =
     SEM_INITIALIZER(0),
     SEM_INITIALIZER(0),
     SP_UNLOCKED,
-    CONFIG_SCHED_HPNTHREADS,
+    HPWORK_NTHREADS,
   }
 };
 
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+struct hp_wqueue_s g_hpwork_cpu[CONFIG_SMP_NCPUS - 1];
+#endif
+
 #endif /* CONFIG_SCHED_HPWORK */
 
 #if defined(CONFIG_SCHED_LPWORK)
@@ -106,10 +110,14 @@ struct lp_wqueue_s g_lpwork =
     SEM_INITIALIZER(0),
     SEM_INITIALIZER(0),
     SP_UNLOCKED,
-    CONFIG_SCHED_LPNTHREADS,
+    LPWORK_NTHREADS,
   }
 };
 
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+struct lp_wqueue_s g_lpwork_cpu[CONFIG_SMP_NCPUS - 1];
+#endif
+
 #endif /* CONFIG_SCHED_LPWORK */
 
 /****************************************************************************
@@ -162,138 +170,255 @@ void work_dispatch(FAR struct kwork_wqueue_s *wq)
 }
 
 /****************************************************************************
- * Name: work_thread
+ * Name: work_owner
  *
  * Description:
- *   These are the worker threads that perform the actions placed on the
- *   high priority work queue.
+ *   Return the queue that owns the work: the per-CPU queue it was last
+ *   added to if that queue is in the same ring as wqueue, else wqueue.
+ *   Only queue addresses are compared, work->wq is never dereferenced.
  *
- *   These, along with the lower priority worker thread(s) are the kernel
- *   mode work queues (also built in the flat build).
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+static inline_function FAR struct kwork_wqueue_s *
+work_owner(FAR struct kwork_wqueue_s *wqueue, FAR struct work_s *work)
+{
+  FAR struct kwork_wqueue_s *owner = work->wq;
+  FAR struct kwork_wqueue_s *curr;
+
+  if (owner != NULL && wqueue->next != NULL)
+    {
+      for (curr = wqueue->next; curr != wqueue; curr = curr->next)
+        {
+          if (curr == owner)
+            {
+              return owner;
+            }
+        }
+    }
+
+  return wqueue;
+}
+#endif
+
+/****************************************************************************
+ * Name: work_run
  *
- *   All kernel mode worker threads are started by the OS during normal
- *   bring up.  This entry point is referenced by OS internally and should
- *   not be accessed by application logic.
+ * Description:
+ *   Run the first expired work of a work queue on behalf of a worker.  The
+ *   worker is marked busy, and its sync waiters are released, under the
+ *   lock of the queue that the work was taken from.
  *
  * Input Parameters:
- *   argc, argv
+ *   wqueue   - The work queue to take the work from
+ *   kworker  - The worker running the work
+ *   dispatch - True to move the expired pending works first
  *
  * Returned Value:
- *   Does not return
+ *   True if a work was run.
  *
  ****************************************************************************/
 
-static int work_thread(int argc, FAR char *argv[])
+static bool work_run(FAR struct kwork_wqueue_s *wqueue,
+                     FAR struct kworker_s *kworker, bool dispatch)
 {
-  FAR struct kwork_wqueue_s *wqueue;
-  FAR struct kworker_s      *kworker;
-  FAR struct work_s         *work;
+  FAR struct work_s *work;
   worker_t      worker;
   irqstate_t    flags;
   FAR void     *arg;
+  bool          found;
 
-  /* Get the handle from argv */
+  /* And check first entry in the work queue. Since we have disabled
+   * interrupts we know:  (1) we will not be suspended unless we do
+   * so ourselves, and (2) there will be no changes to the work queue
+   */
 
-  wqueue  = (FAR struct kwork_wqueue_s *)
-            ((uintptr_t)strtoul(argv[1], NULL, 16));
-  kworker = (FAR struct kworker_s *)
-            ((uintptr_t)strtoul(argv[2], NULL, 16));
+  flags = spin_lock_irqsave(&wqueue->lock);
+  sched_lock();
 
-  /* Loop until wqueue->exit != 0.
-   * Since the only way to set wqueue->exit is to call work_queue_free(),
-   * there is no need for entering the critical section.
+  /* If the wqueue timer is expired and non-active, it indicates that
+   * there might be expired work in the pending queue.
    */
 
-  while (!wqueue->exit)
+  if (dispatch && !WDOG_ISACTIVE(&wqueue->timer))
     {
-      /* And check first entry in the work queue. Since we have disabled
-       * interrupts we know:  (1) we will not be suspended unless we do
-       * so ourselves, and (2) there will be no changes to the work queue
-       */
+      work_dispatch(wqueue);
+    }
 
-      flags = spin_lock_irqsave(&wqueue->lock);
-      sched_lock();
+  found = !list_is_empty(&wqueue->expired);
+  if (found)
+    {
+      work = list_first_entry(&wqueue->expired, struct work_s, node);
 
-      /* If the wqueue timer is expired and non-active, it indicates that
-       * there might be expired work in the pending queue.
+      list_delete(&work->node);
+
+      /* Extract the work description from the entry (in case the
+       * work instance will be reused after it has been de-queued).
        */
 
-      if (!WDOG_ISACTIVE(&wqueue->timer))
+      worker = work->worker;
+
+      /* Extract the work argument (before re-enabling interrupts) */
+
+      arg = work->arg;
+
+      /* Check whether the work is periodic. */
+
+      if (work->period != 0)
         {
-          work_dispatch(wqueue);
-        }
+          /* Calculate next expiration qtime. */
+
+          work->qtime += work->period;
+
+          /* Enqueue to the waiting queue */
+
+          if (work_insert_pending(wqueue, work))
+            {
+              /* We should reset timer if the work is the earliest. */
 
-      if (!list_is_empty(&wqueue->expired))
+              wd_start_abstick(&wqueue->timer, work->qtime,
+                               work_timer_expired, (wdparm_t)wqueue);
+            }
+        }
+      else
         {
-          work = list_first_entry(&wqueue->expired, struct work_s, node);
+          /* Return the work structure ownership to the work owner. */
 
-          list_delete(&work->node);
+          work->worker = NULL;
+        }
 
-          /* Extract the work description from the entry (in case the
-           * work instance will be reused after it has been de-queued).
-           */
+      /* Mark the thread busy */
 
-          worker = work->worker;
+      kworker->work = work;
 
-          /* Extract the work argument (before re-enabling interrupts) */
+      spin_unlock_irqrestore(&wqueue->lock, flags);
+      sched_unlock();
 
-          arg = work->arg;
+      /* Do the work.  Re-enable interrupts while the work is being
+       * performed... we don't have any idea how long this will take!
+       */
 
-          /* Check whether the work is periodic. */
+      CALL_WORKER(worker, arg);
+      flags = spin_lock_irqsave(&wqueue->lock);
+      sched_lock();
 
-          if (work->period != 0)
-            {
-              /* Calculate next expiration qtime. */
+      /* Mark the thread un-busy */
 
-              work->qtime += work->period;
+      kworker->work = NULL;
 
-              /* Enqueue to the waiting queue */
+      /* Check if someone is waiting, if so, wakeup it */
 
-              if (work_insert_pending(wqueue, work))
-                {
-                  /* We should reset timer if the work is the earliest. */
+      while (kworker->wait_count > 0)
+        {
+          kworker->wait_count--;
+          nxsem_post(&kworker->wait);
+        }
+    }
 
-                  wd_start_abstick(&wqueue->timer, work->qtime,
-                                   work_timer_expired, (wdparm_t)wqueue);
-                }
-            }
-          else
-            {
-              /* Return the work structure ownership to the work owner. */
+  spin_unlock_irqrestore(&wqueue->lock, flags);
+  sched_unlock();
+  return found;
+}
 
-              work->worker = NULL;
-            }
+/****************************************************************************
+ * Name: work_steal
+ *
+ * Description:
+ *   Run an expired work of a peer per-CPU queue.  The emptiness test is
+ *   done without the peer lock and is only a hint; work_run() checks again
+ *   under the lock.  The peer timer and its pending works are left to the
+ *   peer's own workers.
+ *
+ * Input Parameters:
+ *   wqueue  - The queue of the idle worker
+ *   kworker - The idle worker
+ *
+ * Returned Value:
+ *   True if a work was run.
+ *
+ ****************************************************************************/
 
-          /* Mark the thread busy */
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+static bool work_steal(FAR struct kwork_wqueue_s *wqueue,
+                       FAR struct kworker_s *kworker)
+{
+  FAR struct kwork_wqueue_s *peer;
 
-          kworker->work = work;
+  for (peer = wqueue->next; peer != wqueue; peer = peer->next)
+    {
+      if (!list_is_empty(&peer->expired) &&
+          work_run(peer, kworker, false))
+        {
+          return true;
+        }
+    }
 
-          spin_unlock_irqrestore(&wqueue->lock, flags);
-          sched_unlock();
+  return false;
+}
+#endif
 
-          /* Do the work.  Re-enable interrupts while the work is being
-           * performed... we don't have any idea how long this will take!
-           */
+/****************************************************************************
+ * Name: work_thread
+ *
+ * Description:
+ *   These are the worker threads that perform the actions placed on the
+ *   high priority work queue.
+ *
+ *   These, along with the lower priority worker thread(s) are the kernel
+ *   mode work queues (also built in the flat build).
+ *
+ *   All kernel mode worker threads are started by the OS during normal
+ *   bring up.  This entry point is referenced by OS internally and should
+ *   not be accessed by application logic.
+ *
+ * Input Parameters:
+ *   argc, argv
+ *
+ * Returned Value:
+ *   Does not return
+ *
+ ****************************************************************************/
 
-          CALL_WORKER(worker, arg);
-          flags = spin_lock_irqsave(&wqueue->lock);
-          sched_lock();
+static int work_thread(int argc, FAR char *argv[])
+{
+  FAR struct kwork_wqueue_s *wqueue;
+  FAR struct kworker_s      *kworker;
 
-          /* Mark the thread un-busy */
+  /* Get the handle from argv */
+
+  wqueue  = (FAR struct kwork_wqueue_s *)
+            ((uintptr_t)strtoul(argv[1], NULL, 16));
+  kworker = (FAR struct kworker_s *)
+            ((uintptr_t)strtoul(argv[2], NULL, 16));
 
-          kworker->work = NULL;
+  /* Loop until wqueue->exit != 0.
+   * Since the only way to set wqueue->exit is to call work_queue_free(),
+   * there is no need for entering the critical section.
+   */
 
-          /* Check if someone is waiting, if so, wakeup it */
+  while (!wqueue->exit)
+    {
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+      if (wqueue->next != NULL)
+        {
+          /* Keep running works, our own first, and only sleep once
+           * neither this queue nor any peer has expired work left.
+           */
 
-          while (kworker->wait_count > 0)
+          if (work_run(wqueue, kworker, true) ||
+              work_steal(wqueue, kworker))
             {
-              kworker->wait_count--;
-              nxsem_post(&kworker->wait);
+              continue;
             }
+
+          atomic_fetch_add(&wqueue->nidle, 1);
+          nxsem_wait_uninterruptible(&wqueue->sem);
+          atomic_fetch_sub(&wqueue->nidle, 1);
+          continue;
         }
+#endif
 
-      spin_unlock_irqrestore(&wqueue->lock, flags);
-      sched_unlock();
+      work_run(wqueue, kworker, true);
 
       /* Wait for the semaphore to be posted by the wqueue timer. */
 
@@ -367,6 +492,90 @@ static int work_thread_create(FAR const char *name, int priority,
   return OK;
 }
 
+/****************************************************************************
+ * Name: work_start_percpu
+ *
+ * Description:
+ *   Start the per-CPU queues of the HP or LP work queue, bind the workers
+ *   of each queue to its CPU and link the queues into a ring.  The CPU0
+ *   queue is statically initialized and may already hold works; it is
+ *   linked last because work_qid2wq() only hands out the other queues once
+ *   its next pointer is set.
+ *
+ * Input Parameters:
+ *   name       - Name of the worker threads
+ *   priority   - Priority of the worker threads
+ *   stack_size - Stack size of the worker threads
+ *   wqueue     - The queue of each CPU
+ *
+ * Returned Value:
+ *   A negated errno value is returned on failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+static int work_start_percpu(FAR const char *name, int priority,
+                             int stack_size,
+                             FAR struct kwork_wqueue_s **wqueue)
+{
+  cpu_set_t cpuset;
+  int wndx;
+  int cpu;
+  int ret;
+
+  /* Bind the workers to their CPU before they run */
+
+  sched_lock();
+
+  for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      if (cpu > 0)
+        {
+          list_initialize(&wqueue[cpu]->expired);
+          list_initialize(&wqueue[cpu]->pending);
+          nxsem_init(&wqueue[cpu]->sem, 0, 0);
+          nxsem_init(&wqueue[cpu]->exsem, 0, 0);
+          spin_lock_init(&wqueue[cpu]->lock);
+          wqueue[cpu]->nthreads = wqueue[0]->nthreads;
+        }
+
+      ret = work_thread_create(name, priority, NULL, stack_size,
+                               wqueue[cpu]);
+      if (ret < 0)
+        {
+          sched_unlock();
+          return ret;
+        }
+
+      CPU_ZERO(&cpuset);
+      CPU_SET(cpu, &cpuset);
+
+      for (wndx = 0; wndx < wqueue[cpu]->nthreads; wndx++)
+        {
+          ret = nxsched_set_affinity(wqueue[cpu]->worker[wndx].pid,
+                                     sizeof(cpuset), &cpuset);
+          if (ret < 0)
+            {
+              serr("ERROR: Failed to bind worker %d to CPU%d: %d\n",
+                   wndx, cpu, ret);
+              sched_unlock();
+              return ret;
+            }
+        }
+    }
+
+  sched_unlock();
+  UP_DMB();
+
+  for (cpu = CONFIG_SMP_NCPUS - 1; cpu >= 0; cpu--)
+    {
+      wqueue[cpu]->next = wqueue[(cpu + 1) % CONFIG_SMP_NCPUS];
+    }
+
+  return OK;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -392,6 +601,99 @@ void work_timer_expired(wdparm_t arg)
   nxsem_post(&wq->sem);
 }
 
+/****************************************************************************
+ * Name: work_lock_queue
+ *
+ * Description:
+ *   Lock the queue that owns the work, moving an idle work of a peer
+ *   per-CPU queue to the queue of the caller when it is queued again.
+ *
+ * Input Parameters:
+ *   wqueue - The queue selected by the caller, updated to the queue that
+ *            has been locked.
+ *   work   - The work to be queued or cancelled.
+ *   queue  - True if the work is about to be queued.
+ *
+ * Returned Value:
+ *   The interrupt state to pass to spin_unlock_irqrestore().
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+irqstate_t work_lock_queue(FAR struct kwork_wqueue_s **wqueue,
+                           FAR struct work_s *work, bool queue)
+{
+  FAR struct kwork_wqueue_s *target = *wqueue;
+  FAR struct kwork_wqueue_s *owner;
+  irqstate_t flags;
+
+  for (; ; )
+    {
+      owner = work_owner(target, work);
+      flags = spin_lock_irqsave(&owner->lock);
+
+      /* work->wq is only changed under the lock of the owner, so recheck
+       * that it did not move while we were spinning.
+       */
+
+      if (owner != work_owner(target, work))
+        {
+          spin_unlock_irqrestore(&owner->lock, flags);
+          continue;
+        }
+
+      /* A work that is neither pending nor running on the peer queue can
+       * be taken over by the queue of the caller.
+       */
+
+      if (queue && owner != target && work_available(work) &&
+          work_get_worker(owner, work, -1) == NULL)
+        {
+          work->wq = target;
+          spin_unlock_irqrestore(&owner->lock, flags);
+          continue;
+        }
+
+      break;
+    }
+
+  work->wq = owner;
+  *wqueue  = owner;
+  return flags;
+}
+
+/****************************************************************************
+ * Name: work_wakeup
+ *
+ * Description:
+ *   Wake up a worker of the queue and, if none of them is idle, an idle
+ *   worker of a peer queue that will steal the work.
+ *
+ * Input Parameters:
+ *   wqueue - The queue the work was added to.
+ *
+ ****************************************************************************/
+
+void work_wakeup(FAR struct kwork_wqueue_s *wqueue)
+{
+  FAR struct kwork_wqueue_s *peer;
+
+  if (wqueue->next != NULL && atomic_read(&wqueue->nidle) == 0)
+    {
+      for (peer = wqueue->next; peer != wqueue; peer = peer->next)
+        {
+          if (atomic_read(&peer->nidle) > 0)
+            {
+              nxsem_post(&peer->sem);
+              break;
+            }
+        }
+    }
+
+  nxsem_post(&wqueue->sem);
+}
+#endif
+
 /****************************************************************************
  * Name: work_queue_create
  *
@@ -566,13 +868,29 @@ int work_queue_priority(int qid)
 #ifdef CONFIG_SCHED_HPWORK
 int work_start_highpri(void)
 {
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+  FAR struct kwork_wqueue_s *wqueue[CONFIG_SMP_NCPUS];
+  int cpu;
+#endif
+
   /* Start the high-priority, kernel mode worker thread(s) */
 
   sinfo("Starting high-priority kernel worker thread(s)\n");
 
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+  wqueue[0] = &g_hpwork.wq;
+  for (cpu = 1; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      wqueue[cpu] = &g_hpwork_cpu[cpu - 1].wq;
+    }
+
+  return work_start_percpu(HPWORKNAME, CONFIG_SCHED_HPWORKPRIORITY,
+                           CONFIG_SCHED_HPWORKSTACKSIZE, wqueue);
+#else
   return work_thread_create(HPWORKNAME, CONFIG_SCHED_HPWORKPRIORITY, NULL,
                             CONFIG_SCHED_HPWORKSTACKSIZE,
                             (FAR struct kwork_wqueue_s *)&g_hpwork);
+#endif
 }
 #endif /* CONFIG_SCHED_HPWORK */
 
@@ -594,13 +912,29 @@ int work_start_highpri(void)
 #ifdef CONFIG_SCHED_LPWORK
 int work_start_lowpri(void)
 {
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+  FAR struct kwork_wqueue_s *wqueue[CONFIG_SMP_NCPUS];
+  int cpu;
+#endif
+
   /* Start the low-priority, kernel mode worker thread(s) */
 
   sinfo("Starting low-priority kernel worker thread(s)\n");
 
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+  wqueue[0] = &g_lpwork.wq;
+  for (cpu = 1; cpu < CONFIG_SMP_NCPUS; cpu++)
+    {
+      wqueue[cpu] = &g_lpwork_cpu[cpu - 1].wq;
+    }
+
+  return work_start_percpu(LPWORKNAME, CONFIG_SCHED_LPWORKPRIORITY,
+                           CONFIG_SCHED_LPWORKSTACKSIZE, wqueue);
+#else
   return work_thread_create(LPWORKNAME, CONFIG_SCHED_LPWORKPRIORITY, NULL,
                             CONFIG_SCHED_LPWORKSTACKSIZE,
                             (FAR struct kwork_wqueue_s *)&g_lpwork);
+#endif
 }
 #endif /* CONFIG_SCHED_LPWORK */
 
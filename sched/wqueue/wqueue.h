@@ -32,6 +32,7 @@
 #include <sys/types.h>
 #include <stdbool.h>
 
+#include <nuttx/atomic.h>
 #include <nuttx/clock.h>
 #include <nuttx/list.h>
 #include <nuttx/wqueue.h>
@@ -48,6 +49,22 @@
 #define HPWORKNAME "hpwork"
 #define LPWORKNAME "lpwork"
 
+/* With per-CPU queues, the threads of the HP and LP thread pools are spread
+ * over one queue per CPU.
+ */
+
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+#  define HPWORK_NTHREADS \
+     ((CONFIG_SCHED_HPNTHREADS + CONFIG_SMP_NCPUS - 1) / CONFIG_SMP_NCPUS)
+#  define LPWORK_NTHREADS \
+     ((CONFIG_SCHED_LPNTHREADS + CONFIG_SMP_NCPUS - 1) / CONFIG_SMP_NCPUS)
+#  define work_next(wqueue) ((wqueue)->next)
+#else
+#  define HPWORK_NTHREADS   CONFIG_SCHED_HPNTHREADS
+#  define LPWORK_NTHREADS   CONFIG_SCHED_LPNTHREADS
+#  define work_next(wqueue) NULL
+#endif
+
 /****************************************************************************
  * Public Type Definitions
  ****************************************************************************/
@@ -74,6 +91,13 @@ struct kwork_wqueue_s
   uint8_t          nthreads;  /* Number of worker threads */
   bool             exit;      /* A flag to request the thread to exit */
   struct wdog_s    timer;     /* Timer to pending. */
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+  atomic_t         nidle;     /* Number of workers waiting on sem */
+
+  /* The queue of the next CPU in the ring of per-CPU queues */
+
+  FAR struct kwork_wqueue_s *next;
+#endif
   struct kworker_s worker[0]; /* Describes a worker thread */
 };
 
@@ -88,7 +112,7 @@ struct hp_wqueue_s
 
   /* Describes each thread in the high priority queue's thread pool */
 
-  struct kworker_s      worker[CONFIG_SCHED_HPNTHREADS];
+  struct kworker_s      worker[HPWORK_NTHREADS];
 };
 #endif
 
@@ -103,7 +127,7 @@ struct lp_wqueue_s
 
   /* Describes each thread in the low priority queue's thread pool */
 
-  struct kworker_s      worker[CONFIG_SCHED_LPNTHREADS];
+  struct kworker_s      worker[LPWORK_NTHREADS];
 };
 #endif
 
@@ -115,12 +139,24 @@ struct lp_wqueue_s
 /* The state of the kernel mode, high priority work queue. */
 
 extern struct hp_wqueue_s g_hpwork;
+
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+/* The high priority work queues of CPU1..n, g_hpwork belongs to CPU0. */
+
+extern struct hp_wqueue_s g_hpwork_cpu[CONFIG_SMP_NCPUS - 1];
+#endif
 #endif
 
 #ifdef CONFIG_SCHED_LPWORK
 /* The state of the kernel mode, low priority work queue(s). */
 
 extern struct lp_wqueue_s g_lpwork;
+
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+/* The low priority work queues of CPU1..n, g_lpwork belongs to CPU0. */
+
+extern struct lp_wqueue_s g_lpwork_cpu[CONFIG_SMP_NCPUS - 1];
+#endif
 #endif
 
 /****************************************************************************
@@ -129,9 +165,24 @@ extern struct lp_wqueue_s g_lpwork;
 
 static inline_function FAR struct kwork_wqueue_s *work_qid2wq(int qid)
 {
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+  int cpu = this_cpu();
+#endif
+
 #ifdef CONFIG_SCHED_HPWORK
   if (qid == HPWORK)
     {
+      /* The ring is linked once all per-CPU queues are started, until
+       * then every CPU shares the CPU0 queue.
+       */
+
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+      if (cpu > 0 && g_hpwork.wq.next != NULL)
+        {
+          return (FAR struct kwork_wqueue_s *)&g_hpwork_cpu[cpu - 1];
+        }
+#endif
+
       return (FAR struct kwork_wqueue_s *)&g_hpwork;
     }
   else
@@ -139,6 +190,13 @@ static inline_function FAR struct kwork_wqueue_s *work_qid2wq(int qid)
 #ifdef CONFIG_SCHED_LPWORK
   if (qid == LPWORK)
     {
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+      if (cpu > 0 && g_lpwork.wq.next != NULL)
+        {
+          return (FAR struct kwork_wqueue_s *)&g_lpwork_cpu[cpu - 1];
+        }
+#endif
+
       return (FAR struct kwork_wqueue_s *)&g_lpwork;
     }
   else
@@ -282,6 +340,98 @@ void work_timer_reset(FAR struct kwork_wqueue_s *wqueue)
     }
 }
 
+/****************************************************************************
+ * Name: work_get_worker
+ *
+ * Description:
+ *   Internal public function to find the worker that is running the work.
+ *   With per-CPU queues every worker of the ring is examined because idle
+ *   workers steal works from their peers.  Require wqueue != NULL and the
+ *   lock of the queue owning the work to be held.
+ *
+ * Input Parameters:
+ *   wqueue - The work queue owning the work.
+ *   work   - The work to look for.
+ *   pid    - A worker to skip (the caller), or -1.
+ *
+ * Returned Value:
+ *   The worker running the work, or NULL if the work is not running.
+ *
+ ****************************************************************************/
+
+static inline_function
+FAR struct kworker_s *work_get_worker(FAR struct kwork_wqueue_s *wqueue,
+                                      FAR struct work_s *work, pid_t pid)
+{
+  FAR struct kwork_wqueue_s *curr = wqueue;
+  int wndx;
+
+  do
+    {
+      for (wndx = 0; wndx < curr->nthreads; wndx++)
+        {
+          if (curr->worker[wndx].work == work &&
+              curr->worker[wndx].pid != pid)
+            {
+              return &curr->worker[wndx];
+            }
+        }
+
+      curr = work_next(curr);
+    }
+  while (curr != NULL && curr != wqueue);
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: work_lock_queue
+ *
+ * Description:
+ *   Internal public function to lock the queue that owns the work.  A work
+ *   stays on the per-CPU queue it was last queued to while it is pending
+ *   or running there.  Otherwise, when queue is true, the work moves to
+ *   the queue passed in, which is the queue of the calling CPU.
+ *
+ * Input Parameters:
+ *   wqueue - The queue selected by the caller, updated to the queue that
+ *            has been locked.
+ *   work   - The work to be queued or cancelled.
+ *   queue  - True if the work is about to be queued.
+ *
+ * Returned Value:
+ *   The interrupt state to pass to spin_unlock_irqrestore().
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+irqstate_t work_lock_queue(FAR struct kwork_wqueue_s **wqueue,
+                           FAR struct work_s *work, bool queue);
+#else
+#  define work_lock_queue(wqueue, work, queue) \
+     spin_lock_irqsave(&(*(wqueue))->lock)
+#endif
+
+/****************************************************************************
+ * Name: work_wakeup
+ *
+ * Description:
+ *   Internal public function to wake up a worker after an immediate work
+ *   has been queued.  If all workers of a per-CPU queue are busy, an idle
+ *   worker of a peer queue is woken up as well so that it can steal the
+ *   work.
+ *
+ * Input Parameters:
+ *   wqueue - The queue the work was added to.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_WORKQUEUE_PERCPU
+void work_wakeup(FAR struct kwork_wqueue_s *wqueue);
+#else
+#  define work_wakeup(wqueue) nxsem_post(&(wqueue)->sem)
+#endif
+
 /****************************************************************************
  * Name: work_start_highpri
  *
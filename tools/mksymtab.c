@@ -40,11 +40,22 @@
 #define MAX_HEADER_FILES 500
 #define SYMTAB_NAME      "g_symtab"
 #define NSYMBOLS_NAME    "g_nsymbols"
+#define MAX_HASH_ENTRIES 65535
 
 /****************************************************************************
  * Private Types
  ****************************************************************************/
 
+/* One symbol table entry, remembered for the hash index (-h) */
+
+struct hash_entry_s
+{
+  char *cond;          /* Conditional compilation, "" if none */
+  unsigned int index;  /* Position in the CSV file */
+  unsigned int hash;   /* GNU hash of the name */
+  unsigned int bucket; /* hash & (nbuckets - 1) */
+};
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -52,6 +63,9 @@
 static const char *g_hdrfiles[MAX_HEADER_FILES];
 static int nhdrfiles;
 
+static struct hash_entry_s *g_entries;
+static unsigned int g_nentries;
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -61,7 +75,8 @@ static void show_usage(const char *progname)
   fprintf(stderr,
     "USAGE:\n");
   fprintf(stderr,
-    "%s [-d] <cvs-file> <symtab-file> [<symtab-name> [<nsymbols-name>]]\n\n",
+    "%s [-d] [-h] <cvs-file> <symtab-file> "
+    "[<symtab-name> [<nsymbols-name>]]\n\n",
     progname);
   fprintf(stderr,
     "Where:\n\n");
@@ -81,6 +96,8 @@ static void show_usage(const char *progname)
     "                   Default: \"%s\"\n", NSYMBOLS_NAME);
   fprintf(stderr,
     "  -d              : Enable debug output\n");
+  fprintf(stderr,
+    "  -h              : Also output a hash index (<symtab-name>_hash)\n");
   exit(EXIT_FAILURE);
 }
 
@@ -118,6 +135,195 @@ static void add_hdrfile(const char *hdrfile)
     }
 }
 
+/* The GNU hash, this must match symtab_hashname() */
+
+static unsigned int hash_name(const char *name)
+{
+  unsigned int hash = 5381;
+
+  while (*name != '\0')
+    {
+      hash = (hash * 33 + (unsigned char)*name++) & 0xffffffff;
+    }
+
+  return hash;
+}
+
+static void add_entry(const char *name, const char *cond)
+{
+  struct hash_entry_s *entry;
+
+  if (g_nentries >= MAX_HASH_ENTRIES)
+    {
+      fprintf(stderr, "ERROR:  Too many symbols for the hash index\n");
+      exit(EXIT_FAILURE);
+    }
+
+  g_entries = realloc(g_entries, (g_nentries + 1) * sizeof(*g_entries));
+  if (g_entries == NULL)
+    {
+      fprintf(stderr, "ERROR:  Out of memory\n");
+      exit(EXIT_FAILURE);
+    }
+
+  entry        = &g_entries[g_nentries];
+  entry->cond  = strdup(cond);
+  entry->index = g_nentries++;
+  entry->hash  = hash_name(name);
+}
+
+static int compare_entry(const void *a, const void *b)
+{
+  const struct hash_entry_s *ea = a;
+  const struct hash_entry_s *eb = b;
+
+  if (ea->bucket != eb->bucket)
+    {
+      return ea->bucket < eb->bucket ? -1 : 1;
+    }
+
+  if (ea->hash != eb->hash)
+    {
+      return ea->hash < eb->hash ? -1 : 1;
+    }
+
+  return ea->index < eb->index ? -1 : 1;
+}
+
+/* Output the hash index of the symbol table.  Entries may be compiled out
+ * by their conditions, so the symtab[] index of each entry and the start
+ * of each bucket are left to the compiler as enumeration values.
+ */
+
+static void output_hash(FILE *outstream, const char *symtab)
+{
+  struct hash_entry_s *entry;
+  unsigned int nbuckets;
+  unsigned int bucket;
+  unsigned int i;
+
+  /* The smallest power of two number of buckets that holds at most two
+   * entries per bucket on average.
+   */
+
+  for (nbuckets = 1; nbuckets * 2 < g_nentries; nbuckets <<= 1);
+
+  for (i = 0; i < g_nentries; i++)
+    {
+      g_entries[i].bucket = g_entries[i].hash & (nbuckets - 1);
+    }
+
+  /* The symtab[] index of each entry */
+
+  fprintf(outstream, "\nenum\n{\n  SYMTAB_IDX_BASE = -1,\n");
+  for (i = 0; i < g_nentries; i++)
+    {
+      entry = &g_entries[i];
+      if (entry->cond[0] != '\0')
+        {
+          fprintf(outstream, "#if %s\n  SYMTAB_IDX_%u,\n#endif\n",
+                  entry->cond, entry->index);
+        }
+      else
+        {
+          fprintf(outstream, "  SYMTAB_IDX_%u,\n", entry->index);
+        }
+    }
+
+  fprintf(outstream, "};\n");
+
+  /* Sort by bucket, then output the chain offset of each bucket */
+
+  qsort(g_entries, g_nentries, sizeof(*g_entries), compare_entry);
+
+  fprintf(outstream, "\nenum\n{\n");
+  for (i = 0, bucket = 0; bucket <= nbuckets; bucket++)
+    {
+      if (bucket == 0)
+        {
+          fprintf(outstream, "  SYMTAB_CHAIN_B0 = 0,\n");
+        }
+      else
+        {
+          fprintf(outstream, "  SYMTAB_CHAIN_B%u,\n", bucket);
+        }
+
+      if (bucket == nbuckets)
+        {
+          break;
+        }
+
+      fprintf(outstream, "  SYMTAB_CHAIN_P%u = SYMTAB_CHAIN_B%u - 1,\n",
+              bucket, bucket);
+
+      for (; i < g_nentries && g_entries[i].bucket == bucket; i++)
+        {
+          entry = &g_entries[i];
+          if (entry->cond[0] != '\0')
+            {
+              fprintf(outstream, "#if %s\n  SYMTAB_CHAIN_E%u,\n#endif\n",
+                      entry->cond, entry->index);
+            }
+          else
+            {
+              fprintf(outstream, "  SYMTAB_CHAIN_E%u,\n", entry->index);
+            }
+        }
+    }
+
+  fprintf(outstream, "};\n");
+
+  /* The bucket and chain tables */
+
+  fprintf(outstream, "\nstatic const uint16_t g_buckets[] =\n{\n");
+  for (bucket = 0; bucket <= nbuckets; bucket++)
+    {
+      fprintf(outstream, "  SYMTAB_CHAIN_B%u,\n", bucket);
+    }
+
+  fprintf(outstream, "};\n");
+
+  /* A trailing zero keeps the chain tables from being empty */
+
+  fprintf(outstream, "\nstatic const uint16_t g_chain[] =\n{\n");
+  for (i = 0; i < g_nentries; i++)
+    {
+      entry = &g_entries[i];
+      if (entry->cond[0] != '\0')
+        {
+          fprintf(outstream, "#if %s\n  SYMTAB_IDX_%u,\n#endif\n",
+                  entry->cond, entry->index);
+        }
+      else
+        {
+          fprintf(outstream, "  SYMTAB_IDX_%u,\n", entry->index);
+        }
+    }
+
+  fprintf(outstream, "  0\n};\n");
+
+  fprintf(outstream, "\nstatic const uint32_t g_hashes[] =\n{\n");
+  for (i = 0; i < g_nentries; i++)
+    {
+      entry = &g_entries[i];
+      if (entry->cond[0] != '\0')
+        {
+          fprintf(outstream, "#if %s\n  0x%08xu,\n#endif\n",
+                  entry->cond, entry->hash);
+        }
+      else
+        {
+          fprintf(outstream, "  0x%08xu,\n", entry->hash);
+        }
+    }
+
+  fprintf(outstream, "  0\n};\n");
+
+  fprintf(outstream, "\nconst struct symtab_hash_s %s_hash =\n{\n", symtab);
+  fprintf(outstream, "  %s, g_buckets, g_chain, g_hashes, %u\n};\n",
+          symtab, nbuckets);
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -133,6 +339,7 @@ int main(int argc, char **argv, char **envp)
   char *ptr;
   bool cond;
   bool parm1;
+  bool hashed;
   FILE *instream;
   FILE *outstream;
   int ch;
@@ -143,8 +350,9 @@ int main(int argc, char **argv, char **envp)
   symtab   = SYMTAB_NAME;
   nsymbols = NSYMBOLS_NAME;
   g_debug  = false;
+  hashed   = false;
 
-  while ((ch = getopt(argc, argv, ":d")) > 0)
+  while ((ch = getopt(argc, argv, ":dh")) > 0)
     {
       switch (ch)
         {
@@ -152,6 +360,10 @@ int main(int argc, char **argv, char **envp)
             g_debug = true;
             break;
 
+          case 'h' :
+            hashed = true;
+            break;
+
           case '?' :
             fprintf(stderr, "Unrecognized option: %c\n", optopt);
             show_usage(argv[0]);
@@ -284,6 +496,11 @@ int main(int argc, char **argv, char **envp)
           exit(EXIT_FAILURE);
         }
 
+      if (hashed)
+        {
+          add_entry(g_parm[NAME_INDEX], g_parm[COND_INDEX]);
+        }
+
       /* Output any conditional compilation */
 
       cond = strlen(g_parm[COND_INDEX]) > 0;
@@ -324,6 +541,11 @@ int main(int argc, char **argv, char **envp)
     "#define NSYMBOLS (sizeof(%s) / sizeof (struct symtab_s))\n", symtab);
   fprintf(outstream, "int %s = NSYMBOLS;\n", nsymbols);
 
+  if (hashed)
+    {
+      output_hash(outstream, symtab);
+    }
+
   /* Close the CSV and symbol table files and exit */
 
   fclose(instream);
@@ -47,11 +47,38 @@ class WDog(Value, p.WDog):
         return self.__repr__()
 
 
+def get_wheel_lists() -> List[gdb.Value]:
+    """Return the lists of the timer wheel (CONFIG_WDOG_TIMER_WHEEL)"""
+
+    wheel = gdb.lookup_static_symbol("g_wdwheel").value()
+    heads = [wheel["expired"], wheel["overflow"]]
+    slot = wheel["slot"]
+    nlevels = slot.type.range()[1] + 1
+    nslots = slot[0].type.range()[1] + 1
+    for level in range(nlevels):
+        for index in range(nslots):
+            heads.append(slot[level][index])
+
+    return heads
+
+
 def get_wdog_list() -> List[WDog]:
     wdogs = []
-    active = utils.parse_and_eval("g_wdactivelist")
-    for wdog in lists.NxList(active, "struct wdog_s", "node"):
-        wdogs.append(WDog(wdog))
+    if gdb.lookup_static_symbol("g_wdwheel"):
+        # The wheel keeps the watchdogs in buckets, sort them by the time
+        # left from the current tick of the wheel.
+
+        curr = int(gdb.lookup_static_symbol("g_wdwheel").value()["curr"])
+        mask = (1 << (8 * utils.lookup_type("clock_t").sizeof)) - 1
+        for head in get_wheel_lists():
+            for wdog in lists.NxList(head, "struct wdog_s", "node"):
+                wdogs.append(WDog(wdog))
+
+        wdogs.sort(key=lambda wdog: (int(wdog.expired) - curr) & mask)
+    else:
+        active = utils.parse_and_eval("g_wdactivelist")
+        for wdog in lists.NxList(active, "struct wdog_s", "node"):
+            wdogs.append(WDog(wdog))
 
     return wdogs
 